@@ -1,36 +0,0 @@
-/*
- *  minikernel/kernel/include/llamsis.h
- *
- *  Minikernel. Versi�n 1.0
- *
- *  Fernando P�rez Costoya
- *
- */
-
-/*
- *
- * Fichero de cabecera que contiene el numero asociado a cada llamada
- *
- * 	SE DEBE MODIFICAR PARA INCLUIR NUEVAS LLAMADAS
- *
- */
-
-#ifndef _LLAMSIS_H
-#define _LLAMSIS_H
-
-/* Numero de llamadas disponibles */
-#define NSERVICIOS 10
-
-#define CREAR_PROCESO 0
-#define TERMINAR_PROCESO 1
-#define ESCRIBIR 2
-#define ID_PROCESO 3
-#define DORMIR 4
-#define CREAR_MUTEX 5
-#define ABRIR_MUTEX 6
-#define LOCK 7
-#define UNLOCK 8
-#define CERRAR_MUTEX 9
-
-#endif /* _LLAMSIS_H */
-
@@ -1,35 +0,0 @@
-/*
- * usuario/excep_arit.c
- *
- *  Minikernel. Versin 1.0
- *
- *  Fernando Prez Costoya
- *
- */
-
-/*
- * Programa de usuario que fuerza una excepcin aritmtica
- */
-
-#include "servicios.h"
-
-#define TOT_ITER 200	/* nmero total de iteraciones */
-#define ITER_EXCEP 22	/* iteracin en la que causa excepcin */
-
-int tot=0;
-
-int main(){
-	int i;
-	int tot=0;
-
-	for (i=0; i<TOT_ITER; i++){
-		printf("excep_arit: i %d \n", i);
-
-		/* Forzando una excepcin */
-		if ((i+1)%ITER_EXCEP==0)
-			i/=tot;
-	}
-	/* No debera llegar ya que ha generado una excepcin */
-	printf("excep_arit: termina\n");
-	return 0;
-}
@@ -0,0 +1,172 @@
+/*
+ *  herramientas/traza_json.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de la maquina anfitriona que convierte la traza del planificador
+ * volcada por el kernel (lineas "TRZ ...") al formato JSON de Chrome
+ * (chrome://tracing o ui.perfetto.dev). Lee la salida del sistema por la
+ * entrada estandar e ignora las lineas que no son de la traza:
+ *
+ *	boot/boot minikernel/kernel | herramientas/traza_json > traza.json
+ *
+ * Genera dos grupos de filas: "UCP", con los intervalos en los que ha
+ * ejecutado cada proceso y sus bloqueos y despertares, y "Llamadas", con
+ * la duracion de cada llamada al sistema.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+/* Deben coincidir con minikernel/include/const.h */
+#define MAX_PROC 10
+#define TRZ_CAMBIO 0
+#define TRZ_DESPERTAR 1
+#define TRZ_BLOQUEO 2
+#define TRZ_LLAMSIS 3
+#define TRZ_FIN_LLAMSIS 4
+#define TRZ_LOCK 5
+#define TRZ_UNLOCK 6
+
+#define PID_UCP 0
+#define PID_LLAMADAS 1
+
+static const char *motivos[]={"dormir", "mutex libre", "lock", "presupuesto",
+	"eventos del agente", "alarma"};
+#define NUM_MOTIVOS (sizeof(motivos)/sizeof(motivos[0]))
+
+static double us_por_tick=10000;	/* 1s/TICK, se lee de la cabecera */
+static int primero=1;				/* para separar eventos con comas */
+
+static int actual=-1;				/* proceso en ejecucion (-1 ninguno) */
+static unsigned long long inicio;	/* tick en que empezo a ejecutar */
+static int visto[MAX_PROC];
+static int en_llamada[MAX_PROC];
+static int servicio[MAX_PROC];
+static unsigned long long entrada[MAX_PROC];
+
+static void separar(){
+	if (!primero)
+		printf(",\n");
+	primero=0;
+}
+
+static void intervalo(int pid, int tid, const char *nombre,
+		unsigned long long desde, unsigned long long hasta){
+	separar();
+	printf("{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,"
+		"\"ts\":%.0f,\"dur\":%.0f}", nombre, pid, tid,
+		desde*us_por_tick, (hasta-desde)*us_por_tick);
+}
+
+static void instantaneo(int tid, const char *nombre, unsigned long long tick){
+	separar();
+	printf("{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":%d,\"tid\":%d,"
+		"\"ts\":%.0f}", nombre, PID_UCP, tid, tick*us_por_tick);
+}
+
+static void cerrar_ejecucion(unsigned long long tick){
+	if (actual>=0)
+		intervalo(PID_UCP, actual, "ejecuta", inicio, tick);
+	actual=-1;
+}
+
+static void tratar_evento(unsigned long long tick, int tipo, int proc, int dato){
+	char nombre[64];
+
+	if (proc<0 || proc>=MAX_PROC)
+		return;
+	visto[proc]=1;
+
+	switch (tipo) {
+	case TRZ_CAMBIO:
+		if (proc==actual && dato==actual)
+			break;		/* vuelve a elegirse el mismo proceso */
+		cerrar_ejecucion(tick);
+		if (dato>=0 && dato<MAX_PROC) {
+			actual=dato;
+			inicio=tick;
+			visto[dato]=1;
+		}
+		break;
+	case TRZ_DESPERTAR:
+		instantaneo(proc, "despertar", tick);
+		break;
+	case TRZ_BLOQUEO:
+		if (proc==actual)
+			cerrar_ejecucion(tick);
+		sprintf(nombre, "bloqueo: %s",
+			(dato>=0 && dato<(int)NUM_MOTIVOS)?motivos[dato]:"?");
+		instantaneo(proc, nombre, tick);
+		break;
+	case TRZ_LLAMSIS:
+		en_llamada[proc]=1;
+		servicio[proc]=dato;
+		entrada[proc]=tick;
+		break;
+	case TRZ_FIN_LLAMSIS:
+		if (!en_llamada[proc])
+			break;
+		sprintf(nombre, "llamada %d", servicio[proc]);
+		intervalo(PID_LLAMADAS, proc, nombre, entrada[proc], tick);
+		en_llamada[proc]=0;
+		break;
+	case TRZ_LOCK:
+		sprintf(nombre, "lock %d", dato);
+		instantaneo(proc, nombre, tick);
+		break;
+	case TRZ_UNLOCK:
+		sprintf(nombre, "unlock %d", dato);
+		instantaneo(proc, nombre, tick);
+		break;
+	}
+}
+
+int main(){
+	char linea[256];
+	unsigned long long tick, ultimo=0;
+	int tipo, proc, dato, frecuencia, perdidos, i;
+
+	printf("{\"traceEvents\":[\n");
+	while (fgets(linea, sizeof(linea), stdin)) {
+		char *p=strstr(linea, "TRZ ");
+		if (!p)
+			continue;
+		if (sscanf(p, "TRZ INICIO %d %d", &frecuencia, &perdidos)==2) {
+			if (frecuencia>0)
+				us_por_tick=1000000.0/frecuencia;
+			if (perdidos>0)
+				fprintf(stderr, "traza_json: %d eventos perdidos\n", perdidos);
+		}
+		else if (strncmp(p, "TRZ FIN", 7)==0)
+			cerrar_ejecucion(ultimo);
+		else if (sscanf(p, "TRZ %llu %d %d %d", &tick, &tipo, &proc, &dato)==4) {
+			tratar_evento(tick, tipo, proc, dato);
+			ultimo=tick;
+		}
+	}
+	cerrar_ejecucion(ultimo);
+
+	/* Nombres de las filas */
+	separar();
+	printf("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+		"\"args\":{\"name\":\"UCP\"}}", PID_UCP);
+	separar();
+	printf("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+		"\"args\":{\"name\":\"Llamadas\"}}", PID_LLAMADAS);
+	for (i=0; i<MAX_PROC; i++) {
+		if (!visto[i])
+			continue;
+		separar();
+		printf("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,"
+			"\"args\":{\"name\":\"proceso %d\"}}", PID_UCP, i, i);
+		separar();
+		printf("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,"
+			"\"args\":{\"name\":\"proceso %d\"}}", PID_LLAMADAS, i, i);
+	}
+	printf("\n]}\n");
+	return 0;
+}
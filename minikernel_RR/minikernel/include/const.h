@@ -63,15 +63,159 @@
 
 /* frecuencia de reloj requerida (ticks/segundo) */
 #define TICK 100
-
-/* constante usada en implementacion de round robin */
-#define TICKS_POR_RODAJA 10
+#define MS_POR_TICK (1000/TICK)
+
+/* tick dinamico: si vale 1, cuando no hay procesos listos el reloj se
+   reprograma para interrumpir solo cuando vence el siguiente evento y los
+   ticks saltados se procesan de golpe al despertar */
+#define TICK_DINAMICO 1
+
+/* rueda jerarquica de temporizadores: NIVELES_RUEDA niveles de TAM_RUEDA
+   cubos; el nivel i guarda los que vencen dentro de menos de
+   TAM_RUEDA^(i+1) ticks y se reparte al nivel inferior al pasar por el */
+#define BITS_RUEDA 6
+#define TAM_RUEDA (1<<BITS_RUEDA)
+#define MASCARA_RUEDA (TAM_RUEDA-1)
+#define NIVELES_RUEDA 4
+
+/* expulsion al despertar: si vale 1, un proceso que se desbloquea y es mas
+   urgente que el que esta en ejecucion lo expulsa en cuanto es seguro, sin
+   esperar a que venza la rodaja de este */
+#define EXPULSION_DESPERTAR 1
+
+/* constantes usadas en la cola de listos multinivel con realimentacion
+   (la rodaja de cada nivel esta en rodaja_nivel, ver kernel.h) */
+#define NUM_PRIORIDADES 8 /* niveles de prioridad (0 es el mas urgente) */
+#define PRIORIDAD_DEFECTO 4 /* prioridad con la que se crea un proceso */
+#define TICKS_POR_BOOST 100 /* cada cuanto se devuelven todos los procesos
+			       a su prioridad base para evitar inanicion */
+#define ESPERA_ENVEJECIMIENTO 50 /* ticks en la cola de listos sin ejecutar
+				    tras los que un proceso sube un nivel,
+				    incluso por encima de su prioridad base */
+
+/* politicas de planificacion disponibles (indices de tabla_clases). Se
+   elige al arrancar con la variable de entorno POLITICA (mlfq, cfs, stride,
+   fifo, rr, grupos o rafaga); si no esta definida se usa la de POLITICA */
+#define POL_MLFQ 0 /* cola multinivel con realimentacion */
+#define POL_CFS 1 /* planificacion justa por tiempo virtual */
+#define POL_STRIDE 2 /* reparto proporcional por tickets (stride) */
+#define POL_FIFO 3 /* por orden de llegada sin expulsion por tiempo */
+#define POL_RR 4 /* round robin con rodaja fija */
+#define POL_GRUPOS 5 /* reparto justo entre grupos de procesos */
+#define POL_RAFAGA 6 /* primero la rafaga prevista mas corta */
+#define NUM_POLITICAS 7
+#define POLITICA POL_MLFQ /* politica usada por defecto */
+
+/* clases de planificacion de cada proceso (sis_fijar_politica). Detras de
+   los de tiempo real EDF se atienden en este orden: FIFO, NORMAL, LOTE y
+   OCIOSA */
+#define CLASE_NORMAL 0 /* gestionada por la politica elegida al arrancar */
+#define CLASE_FIFO 1 /* tiempo real FIFO: sin rodaja, por delante de los normales */
+#define CLASE_LOTE 2 /* rodaja larga y nunca expulsa a otro al despertar */
+#define CLASE_OCIOSA 3 /* solo ejecuta si no hay ningun otro listo */
+#define NUM_CLASES 4
+
+/* constantes usadas en round robin. La rodaja se adapta segun la
+   interactividad del proceso: sube cada vez que se bloquea en dormir o lock
+   y baja cada vez que agota la rodaja */
+#define TICKS_POR_RODAJA 10 /* rodaja de los procesos sin clasificar */
+#define INTERACTIVIDAD_MAX 8 /* tope de la puntuacion de interactividad */
+#define INTERACTIVIDAD_INICIAL 4 /* puntuacion de un proceso nuevo */
+#define UMBRAL_INTERACTIVO 6 /* desde aqui es interactivo */
+#define UMBRAL_LOTE 2 /* hasta aqui es de lote (usa mucha UCP) */
+#define RODAJA_INTERACTIVA 4 /* rodaja corta de los interactivos */
+#define RODAJA_LOTE 20 /* rodaja larga de los de lote */
+
+/* constante usada en el aviso de no expulsion: prorroga que se concede una
+   sola vez por rodaja al proceso que esta dentro de una seccion critica */
+#define PRORROGA_RODAJA 2
+
+/* constantes usadas en la planificacion justa por tiempo virtual (CFS).
+   El tiempo virtual se mide en ticks*PESO_NICE_0 */
+#define NICE_MIN -20
+#define NICE_MAX 19
+#define PESO_NICE_0 1024 /* peso de un proceso con nice 0 */
+#define GRANULARIDAD_CFS 3 /* ticks de ventaja sobre el primero de la cola
+			      antes de expulsar al proceso actual */
+#define CREDITO_DORMIDO_CFS 5 /* ticks de tiempo virtual que como maximo
+				 gana un proceso mientras esta bloqueado */
+#define GRANULARIDAD_DESPERTAR_CFS 1 /* ticks de tiempo virtual que debe
+					llevar de ventaja un proceso que
+					despierta para expulsar al actual */
+
+/* constantes usadas en la planificacion proporcional por tickets (stride) */
+#define STRIDE1 (1<<20) /* zancada = STRIDE1/tickets */
+#define TICKETS_DEFECTO 100 /* tickets con los que se crea un proceso */
+#define MAX_TICKETS 10000 /* maximo de tickets que se pueden fijar */
+#define RODAJA_STRIDE 5 /* rodaja en ticks de cada turno */
+
+/* constantes usadas en el reparto justo entre grupos de procesos. Cada
+   grupo avanza su pase en STRIDE1/peso por tick ejecutado por cualquiera
+   de sus procesos */
+#define MAX_GRUPOS MAX_PROC /* numero maximo de grupos (el 0 es el inicial) */
+#define PESO_GRUPO_DEFECTO 100 /* peso del grupo inicial */
+#define MAX_PESO_GRUPO 10000 /* maximo peso que se puede dar a un grupo */
+
+/* constantes usadas en la prevision de rafagas de UCP. La rafaga prevista
+   es una media movil exponencial en coma fija con FRAC_RAFAGA bits
+   decimales */
+#define FRAC_RAFAGA 4
+#define FIJO_RAFAGA (1<<FRAC_RAFAGA) /* rafaga de 1 tick en coma fija */
+#define ALFA_RAFAGA 4 /* peso de la ultima rafaga en la media (en octavos) */
+#define RAFAGA_INICIAL 5 /* rafaga prevista de un proceso nuevo (ticks) */
+
+/* constantes usadas en la clase de tiempo real por plazos (EDF) */
+#define ESCALA_UTIL (1<<20) /* utilizacion 1 en coma fija para el control
+			       de admision */
+
+/* constantes usadas en las estadisticas de carga. Las medias se guardan en
+   coma fija con FRAC_CARGA bits decimales y se actualizan una vez por
+   segundo con la media de las muestras de cada tick */
+#define FRAC_CARGA 16
+#define FIJO_CARGA (1<<FRAC_CARGA) /* carga 1 en coma fija */
+#define EXP_CARGA_1S 24109 /* FIJO_CARGA*exp(-1/1) */
+#define EXP_CARGA_10S 59300 /* FIJO_CARGA*exp(-1/10) */
+#define EXP_CARGA_60S 64453 /* FIJO_CARGA*exp(-1/60) */
+#define TAM_HISTOGRAMA (MAX_PROC+1) /* longitudes posibles de la cola de
+				       listos (0 a MAX_PROC) */
+
+/* constantes usadas en la traza binaria del planificador */
+#define TAM_TRAZA 1024 /* eventos que guarda el buffer circular (potencia
+			  de 2): al llenarse se pierden los mas antiguos */
+#define TRZ_CAMBIO 0 /* cambio de contexto: dato es el proceso entrante */
+#define TRZ_DESPERTAR 1 /* el proceso pasa de bloqueado a listo */
+#define TRZ_BLOQUEO 2 /* el proceso se bloquea: dato es el motivo */
+#define TRZ_LLAMSIS 3 /* entrada a llamada: dato es el servicio */
+#define TRZ_FIN_LLAMSIS 4 /* salida de llamada: dato es el resultado */
+#define TRZ_LOCK 5 /* consigue un mutex: dato es el descriptor */
+#define TRZ_UNLOCK 6 /* suelta un mutex: dato es el descriptor */
+
+/* motivos de bloqueo registrados en la traza */
+#define BLQ_DORMIR 0
+#define BLQ_MUTEX_LIBRE 1 /* espera a que haya un mutex libre */
+#define BLQ_LOCK 2
+#define BLQ_PRESUPUESTO 3 /* EDF. agoto su presupuesto en el periodo */
+#define BLQ_AGENTE 4 /* el agente de planificacion espera eventos */
+#define BLQ_ALARMA 5 /* espera a que venza su alarma */
+
+/* constantes usadas por el agente de planificacion en modo usuario */
+#define TAM_ANILLO_AGENTE 32 /* eventos que caben en el anillo compartido */
+#define PLAZO_AGENTE 20 /* ticks que puede tardar en atender un evento o
+			   ejecutar seguido antes de que se le retire */
+#define EVT_NUEVO 0 /* se ha creado el proceso */
+#define EVT_DESPERTAR 1 /* el proceso pasa de bloqueado a listo */
+#define EVT_BLOQUEO 2 /* el proceso se bloquea */
+#define EVT_EXPULSION 3 /* el proceso vuelve a la cola de listos expulsado
+			   (p.ej. al agotar su rodaja) */
+#define EVT_FIN 4 /* el proceso termina */
 
 /* constantes usada en implementacion de mutex */
 #define NUM_MUT 16 /* numero total de mutex en el sistema */
 #define NUM_MUT_PROC 4 /* numero maximo de mutex que puede tener
 			  abiertos un proceso */
 #define MAX_NOM_MUT 8 /* longitud maxima de un nombre de mutex */
+#define PLAZO_VENCIDO -4 /* error de lock_timeout y crear_mutex_timeout al
+			    vencer el plazo sin conseguir el mutex */
 
 /* constante usada en implementacion de manejador de terminal */
 #define TAM_BUF_TERM 8 /* tama�o del buffer del terminal */
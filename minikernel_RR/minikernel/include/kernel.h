@@ -30,6 +30,65 @@
  */
 typedef struct BCP_t *BCPptr;
 
+/*
+ * Contabilidad de uso de UCP de un proceso (en ticks). La copia que
+ * devuelve sis_obtener_info_cpu debe coincidir con la de servicios.h
+ */
+typedef struct {
+	unsigned int ticks_usuario;				/* ticks ejecutando en modo usuario */
+	unsigned int ticks_nucleo;				/* ticks ejecutando en modo sistema */
+	unsigned int ticks_espera;				/* ticks en LISTO esperando la UCP */
+	unsigned int cambios_voluntarios;		/* veces que ha cedido la UCP al bloquearse */
+	unsigned int cambios_involuntarios;		/* veces que ha sido expulsado */
+	unsigned int espera_maxima;				/* mayor espera en LISTO antes de ejecutar */
+	unsigned int ultima_rafaga;				/* ticks que ejecuto la ultima vez que tuvo la UCP */
+	unsigned int rafaga_prevista;			/* media movil de sus rafagas (coma fija,
+											   FIJO_RAFAGA es 1 tick) */
+	unsigned int nivel;						/* MLFQ. nivel actual en la cola de listos
+											   (se rellena al consultarlo) */
+	unsigned int tickets;					/* STRIDE. tickets actuales, con los que
+											   le prestan (se rellena al consultarlo) */
+} info_cpu;
+
+/*
+ * Aviso de no expulsion compartido con el proceso: el proceso marca
+ * en_seccion mientras esta en una seccion critica corta y el nucleo marca
+ * ceder_pendiente si le ha prorrogado la rodaja por ello. Debe coincidir
+ * con la de servicios.h
+ */
+typedef struct {
+	volatile int en_seccion;				/* lo escribe el proceso */
+	volatile int ceder_pendiente;			/* lo escribe el nucleo */
+} aviso_expulsion;
+
+/*
+ * Temporizador del nucleo. Al vencer (en el tick absoluto vence) se llama
+ * a vencer desde la interrupcion de reloj a nivel 3. Mientras esta armado
+ * esta en un cubo de la rueda, en una lista doblemente enlazada para poder
+ * cancelarlo sin recorrerla.
+ */
+typedef struct temporizador_t {
+	unsigned long long vence;				/* tick absoluto en el que vence */
+	void (*vencer)(struct temporizador_t *t);	/* accion al vencer */
+	void *dato;								/* dato para la accion (p.ej. el BCP) */
+	struct temporizador_t *anterior;		/* vecinos en el cubo */
+	struct temporizador_t *siguiente;
+	struct temporizador_t **cubo;			/* cubo en el que esta (NULL si no armado) */
+} temporizador;
+
+/*
+ * Pagina compartida con los procesos (al estilo de un vDSO): el nucleo la
+ * actualiza en cada tick y cambio de proceso, y la biblioteca la lee sin
+ * llamada al sistema. secuencia es impar mientras el nucleo la escribe.
+ * Debe coincidir con la de servicios.h
+ */
+typedef struct {
+	volatile unsigned int secuencia;		/* cambia antes y despues de escribir */
+	volatile int id_actual;					/* proceso en ejecucion */
+	volatile unsigned long long ticks;		/* ticks desde el arranque */
+	volatile unsigned long long reloj_base;	/* ms del reloj CMOS en el tick 0 */
+} pagina_nucleo;
+
 typedef struct BCP_t {
     int id;									/* ident. del proceso */
     int estado;								/* TERMINADO|LISTO|EJECUCION|BLOQUEADO*/
@@ -37,11 +96,60 @@ typedef struct BCP_t {
     void * pila;							/* dir. inicial de la pila */
 	BCPptr siguiente;						/* puntero a otro BCP */
 	void *info_mem;							/* descriptor del mapa de memoria */
-	unsigned int ticksDormido;  			/* número de ticks que tienes que estar dormido */
+	temporizador despertador;				/* vence cuando debe despertar de dormir */
+	temporizador alarma;					/* alarma del proceso */
+	unsigned int periodo_alarma;			/* ticks entre vencimientos (0 si es de una vez) */
+	unsigned int alarmas_pendientes;		/* vencimientos aun no recogidos */
+	int esperando_alarma;					/* esta bloqueado en esperar_alarma */
 	int descriptores_mutex[NUM_MUT_PROC];	/* array de descriptores de cada proceso */
+	int mutex_espera;						/* espera con plazo: mutex en cuya lista
+											   espera (-1 la de mutex libre) */
+	int plazo_vencido;						/* le ha despertado el plazo de su espera */
 
 	//Round-Robin:
-	unsigned int rodaja;					/* tiempo de ejecucion que le queda al proceso o rodaja */
+	unsigned long long fin_rodaja;			/* tick en el que vence su rodaja actual */
+	int interactividad;						/* sube al bloquearse y baja al agotar la rodaja */
+	aviso_expulsion *aviso;					/* aviso de no expulsion (NULL si no tiene) */
+	int prorrogado;							/* ya se le ha prorrogado la rodaja actual */
+
+	//Clase de planificacion:
+	int clase_proc;							/* CLASE_NORMAL|CLASE_FIFO|CLASE_LOTE|CLASE_OCIOSA */
+	int grupo;								/* grupo de procesos al que pertenece */
+
+	//Prioridades:
+	int prioridad;							/* prioridad base: nivel maximo al que puede subir */
+	int nivel;								/* MLFQ. nivel actual en la cola de listos (0 el mas urgente) */
+
+	//CFS:
+	int nice;								/* valor de nice (NICE_MIN a NICE_MAX) */
+	unsigned int peso;						/* peso asociado a su nice */
+	unsigned long long vruntime;			/* tiempo virtual de ejecucion acumulado */
+
+	//STRIDE:
+	unsigned int tickets;					/* tickets propios mas los prestados por otros */
+	unsigned int zancada;					/* STRIDE1/tickets: lo que avanza el pase por tick */
+	unsigned long long pase;				/* pase acumulado: ejecuta el de menor pase */
+	int prestado_a;							/* proceso al que presta sus tickets (-1 ninguno) */
+	unsigned int tickets_prestados;			/* tickets que tiene prestados */
+
+	//EDF (tiempos en ticks):
+	int tiempo_real;						/* 1 si pertenece a la clase de tiempo real */
+	unsigned int rt_ejecucion;				/* tiempo de ejecucion por periodo */
+	unsigned int rt_periodo;				/* periodo */
+	unsigned int rt_plazo;					/* plazo relativo al inicio del periodo */
+	unsigned int rt_presupuesto;			/* ejecucion que le queda en el periodo actual */
+	unsigned long long rt_plazo_abs;		/* plazo absoluto del periodo actual */
+	unsigned long long rt_activacion;		/* inicio del siguiente periodo */
+
+	//Monticulo en el que esta insertado:
+	unsigned long long clave;				/* clave por la que se ordena */
+	int pos_mont;							/* posicion dentro del monticulo */
+
+	//Contabilidad:
+	info_cpu cpu;							/* uso de UCP acumulado */
+	unsigned long long tick_listo;			/* tick en el que entro en la cola de listos */
+	unsigned long long tick_edad;			/* MLFQ. tick desde el que cuenta su envejecimiento */
+	unsigned long long tick_rafaga;			/* tick en el que empezo su rafaga actual */
 	
 } BCP;
 
@@ -58,8 +166,121 @@ typedef struct BCP_t {
 typedef struct{
 	BCP *primero;
 	BCP *ultimo;
+	int n;						/* numero de elementos */
 } lista_BCPs;
 
+/*
+ *
+ * Definicion del tipo que corresponde con un monticulo binario de BCPs
+ * ordenado por menor clave. Como cada proceso esta en una unica cola a la
+ * vez, la clave y la posicion se guardan en el propio BCP.
+ *
+ */
+
+typedef struct{
+	BCP *elem[MAX_PROC];
+	int n;
+} monticulo_BCPs;
+
+/*
+ *
+ * Definicion del tipo que corresponde con un evento de la traza del
+ * planificador. Se guarda en binario y solo se formatea al volcarla.
+ *
+ */
+
+typedef struct{
+	unsigned long long tick;	/* instante del evento */
+	int tipo;					/* TRZ_CAMBIO|TRZ_DESPERTAR|TRZ_BLOQUEO|... */
+	int proc;					/* proceso al que se refiere */
+	int dato;					/* depende del tipo (ver const.h) */
+} evento_traza;
+
+/*
+ *
+ * Definicion del tipo con las estadisticas de carga que devuelve
+ * sis_obtener_carga. Debe coincidir con la de servicios.h
+ *
+ */
+
+typedef struct{
+	unsigned int carga[3];		/* media de procesos listos o en ejecucion a
+								   1s, 10s y 60s (coma fija, FIJO_CARGA es 1) */
+	unsigned int listos;		/* longitud actual de la cola de listos */
+	unsigned int dormidos;		/* procesos dormidos */
+	unsigned int esperando_mutex;	/* procesos esperando por un mutex */
+	unsigned int histograma[TAM_HISTOGRAMA];	/* ticks con i procesos en
+												   la cola de listos */
+} info_carga;
+
+/*
+ *
+ * Definicion del tipo que corresponde con una clase de planificacion:
+ * agrupa las decisiones de la politica en uso sobre la cola de listos.
+ * Los procesos de tiempo real (EDF) van siempre por delante y no pasan
+ * por ella.
+ *
+ */
+
+typedef struct{
+	const char *nombre;					/* nombre con el que se elige al arrancar */
+	void (*encolar)(BCP *proc);			/* inserta en la cola de listos */
+	void (*desencolar)(BCP *proc);		/* elimina de la cola de listos */
+	BCP * (*primero)();					/* siguiente a ejecutar, sin sacarlo */
+	void (*tick)(unsigned int n, BCP *actual);	/* han pasado n ticks; actual es
+										   el proceso de la clase en ejecucion
+										   o NULL */
+	int (*despertar)(BCP *proc, BCP *actual);	/* ajusta al que se desbloquea
+										   antes de encolarlo y dice si debe
+										   expulsar a actual */
+	unsigned int (*rodaja)(BCP *proc);	/* rodaja en ticks (0 sin limite) */
+	int (*prioridad)(BCP *proc, BCP *actual);	/* proc ha cambiado de
+										   prioridad (ya recolocado); dice si
+										   debe expulsar a actual */
+} clase_planificacion;
+
+/*
+ *
+ * Definicion del tipo que corresponde con un grupo de procesos. Con la
+ * politica POL_GRUPOS la UCP se reparte primero entre los grupos segun su
+ * peso (como en STRIDE, por pase) y luego por turnos entre sus procesos.
+ *
+ */
+
+typedef struct{
+	int usado;						/* 0-libre, 1-creado */
+	unsigned int peso;				/* parte de la UCP que le corresponde */
+	unsigned int zancada;			/* STRIDE1/peso */
+	unsigned long long pase;		/* pase acumulado por sus procesos */
+	unsigned int n_procs;			/* procesos vivos que pertenecen a el */
+	BCP *creador;					/* proceso que lo creo mientras viva */
+	lista_BCPs listos;				/* sus procesos listos */
+} grupo;
+
+/*
+ *
+ * Definicion de los tipos del anillo compartido con el agente de
+ * planificacion en modo usuario: el nucleo publica eventos en cabeza y el
+ * agente los consume avanzando cola; el agente deja en decision el
+ * proceso que debe ejecutar a continuacion. Debe coincidir con servicios.h
+ *
+ */
+
+typedef struct{
+	int tipo;						/* EVT_* */
+	int proc;						/* proceso al que se refiere */
+	unsigned int tick;				/* tick en el que se produjo */
+} evento_agente;
+
+typedef struct{
+	volatile unsigned int cabeza;	/* eventos publicados (lo escribe el nucleo) */
+	volatile unsigned int cola;		/* eventos consumidos (lo escribe el agente) */
+	volatile unsigned int perdidos;	/* eventos que no cabian en el anillo */
+	volatile int decision;			/* proceso a ejecutar (-1 ninguno); el nucleo
+									   la vuelve a poner a -1 al usarla */
+	evento_agente eventos[TAM_ANILLO_AGENTE];
+} anillo_agente;
+
 typedef struct MUTEX_t *MUTEXptr;
 
 typedef struct MUTEX_t { 
@@ -97,14 +318,162 @@ BCP tabla_procs[MAX_PROC];
 MUTEX tabla_mutexs[NUM_MUT];
 
 /*
- * Variable global que representa la cola de procesos listos
+ * Variable global que representa la tabla de grupos de procesos y el
+ * menor pase de los grupos en juego (para los que vuelven a tener listos)
+ */
+
+grupo tabla_grupos[MAX_GRUPOS];
+unsigned long long pase_minimo_grupos=0;
+
+/*
+ * Variable global que representa la cola de procesos listos: una lista
+ * por nivel de prioridad y un mapa de bits con los niveles no vacios
+ * (bit i activo <=> lista_listos[i] no vacia)
  */
-lista_BCPs lista_listos= {NULL, NULL};
+lista_BCPs lista_listos[NUM_PRIORIDADES];
+unsigned int mapa_listos=0;
 
 /*
- * I. Variable global que representa la cola de procesos dormido
+ * MLFQ. Rodaja (en ticks) de cada nivel de la cola de listos: cuanto menos
+ * urgente es el nivel mas larga es la rodaja
  */
-lista_BCPs lista_dormidos= {NULL, NULL};
+unsigned int rodaja_nivel[NUM_PRIORIDADES]={2, 4, 6, 8, 10, 20, 40, 80};
+
+/*
+ * MLFQ. Ticks que faltan para el siguiente boost de prioridades
+ */
+unsigned int ticks_hasta_boost=TICKS_POR_BOOST;
+
+/*
+ * Variable global con el numero de ticks desde el arranque
+ */
+unsigned long long ticks_sistema=0;
+
+/*
+ * Rueda jerarquica de temporizadores, tick hasta el que se ha procesado
+ * y numero de temporizadores armados
+ */
+temporizador *rueda[NIVELES_RUEDA][TAM_RUEDA];
+unsigned long long tick_rueda=0;
+int temporizadores_armados=0;
+
+/*
+ * Pagina que se comparte con los procesos (alineada a pagina)
+ */
+pagina_nucleo pagina_compartida __attribute__((aligned(4096)));
+
+/*
+ * Variable global que indica que el planificador espera una interrupcion
+ * por no haber procesos listos: p_proc_actual no esta en ejecucion aunque
+ * lo despierte la propia interrupcion
+ */
+int en_espera=0;
+
+/*
+ * Tick dinamico. Indica si el reloj esta reprogramado por estar el sistema
+ * en reposo, la frecuencia programada y el instante (en ms del reloj CMOS)
+ * hasta el que se han contabilizado ticks
+ */
+int tick_dinamico_activo=0;
+unsigned int frecuencia_reloj=TICK;
+unsigned long long ms_ultimo_tick=0;
+
+/*
+ * EDF. Cola de listos de tiempo real ordenada por plazo absoluto y lista
+ * de procesos que han agotado su presupuesto y esperan a su siguiente periodo
+ */
+monticulo_BCPs monticulo_rt;
+lista_BCPs lista_rt_agotados= {NULL, NULL};
+
+/*
+ * Variable global con la politica de planificacion en uso (su clase esta
+ * en la variable clase, definida tras tabla_clases)
+ */
+int politica=POLITICA;
+
+/*
+ * Agente de planificacion en modo usuario (NULL si no hay), anillo que
+ * comparte con el nucleo y lista en la que espera eventos
+ */
+BCP *agente=NULL;
+anillo_agente *anillo=NULL;
+
+/*
+ * Proceso al que esta reservado el papel de agente: el primero que se
+ * registra, mientras viva (aunque se le retire puede volver a registrarse
+ * y ningun otro puede hacerlo)
+ */
+BCP *titular_agente=NULL;
+lista_BCPs lista_agente= {NULL, NULL};
+
+/*
+ * FIFO y RR. Cola de listos unica (en RR, la de los no interactivos)
+ */
+lista_BCPs lista_fifo= {NULL, NULL};
+
+/*
+ * RR. Cola de listos de los procesos interactivos, que va por delante
+ */
+lista_BCPs lista_interactivos= {NULL, NULL};
+
+/*
+ * Colas de listos de las clases de proceso que no son la normal
+ */
+lista_BCPs lista_clase_fifo= {NULL, NULL};
+lista_BCPs lista_clase_lote= {NULL, NULL};
+lista_BCPs lista_clase_ociosa= {NULL, NULL};
+
+/*
+ * CFS y STRIDE. Cola de listos ordenada por tiempo virtual (CFS) o por
+ * pase (STRIDE)
+ */
+monticulo_BCPs monticulo_listos;
+
+/*
+ * CFS. Tiempo virtual minimo (no decreciente) usado para colocar procesos
+ * nuevos y despertados
+ */
+unsigned long long min_vruntime=0;
+
+/*
+ * STRIDE. Pase minimo (no decreciente) usado para colocar procesos nuevos
+ * y despertados
+ */
+unsigned long long pase_minimo=0;
+
+/*
+ * CFS. Peso de cada valor de nice (de NICE_MIN a NICE_MAX), como en Linux:
+ * cada nivel de nice supone aproximadamente un 10% mas o menos de CPU
+ */
+const unsigned int peso_nice[NICE_MAX-NICE_MIN+1]={
+	88761, 71755, 56483, 46273, 36291, 29154, 23254, 18705, 14949, 11916,
+	 9548,  7620,  6100,  4904,  3906,  3121,  2501,  1991,  1586,  1277,
+	 1024,   820,   655,   526,   423,   335,   272,   215,   172,   137,
+	  110,    87,    70,    56,    45,    36,    29,    23,    18,    15};
+
+/*
+ * L. Estadisticas de carga: medias exponenciales a 1s, 10s y 60s, suma de
+ * las muestras del segundo en curso y ticks que lleva, e histograma de
+ * ticks por longitud de la cola de listos
+ */
+unsigned int media_carga[3]={0, 0, 0};
+const unsigned int exp_carga[3]={EXP_CARGA_1S, EXP_CARGA_10S, EXP_CARGA_60S};
+unsigned int suma_carga=0;
+unsigned int ticks_carga=0;
+unsigned int histograma_listos[TAM_HISTOGRAMA];
+
+/*
+ * T. Buffer circular con la traza del planificador y numero de eventos
+ * registrados desde el ultimo volcado
+ */
+evento_traza traza[TAM_TRAZA];
+unsigned int n_traza=0;
+
+/*
+ * I. Numero de procesos dormidos (no estan en ninguna lista: los despierta
+ * su temporizador)
+ */
+int num_dormidos=0;
 
 /*
  * I. Variable global que represental la cola de procesos bloqueados por mutex
@@ -142,6 +511,122 @@ int sis_lock();
 int sis_unlock();
 /*I. Funcion que cierra el mutex pasandole el id del mutex */
 int sis_cerrar_mutex();
+/*P. Funcion que fija la prioridad de un proceso */
+int sis_fijar_prioridad();
+/*CFS. Funcion que fija el nice de un proceso */
+int sis_fijar_nice();
+/*STRIDE. Funcion que fija los tickets de un proceso */
+int sis_fijar_tickets();
+/*STRIDE. Funcion que transfiere tickets del proceso actual a otro */
+int sis_transferir_tickets();
+/*EDF. Funcion que declara los parametros de tiempo real del proceso */
+int sis_fijar_plazo();
+/*C. Funcion que devuelve la contabilidad de UCP de un proceso */
+int sis_obtener_info_cpu();
+/*T. Funcion que vuelca por el terminal la traza del planificador */
+int sis_volcar_traza();
+/*CE. Funcion que cede la UCP */
+int sis_ceder();
+/*CE. Funcion que cede lo que queda de la rodaja a un proceso listo */
+int sis_ceder_a();
+/*L. Funcion que devuelve las estadisticas de carga */
+int sis_obtener_carga();
+/*CL. Funcion que fija la clase de planificacion de un proceso */
+int sis_fijar_politica();
+/*AV. Funcion que fija el aviso de no expulsion del proceso actual */
+int sis_fijar_aviso_expulsion();
+/*GRUPOS. Funcion que crea un grupo de procesos vacio */
+int sis_crear_grupo();
+/*GRUPOS. Funcion que pasa el proceso actual a un grupo */
+int sis_unirse_grupo();
+/*AG. Funcion que registra al proceso actual como agente de planificacion */
+int sis_registrar_agente();
+/*AG. Funcion que bloquea al agente hasta que haya eventos sin atender */
+int sis_esperar_eventos();
+/*I. Funcion que duerme el proceso unos milisegundos */
+int sis_dormir_ms();
+/*I. Funcion que duerme el proceso hasta un tick absoluto */
+int sis_dormir_hasta();
+/*I. Funcion que devuelve los ticks desde el arranque */
+int sis_obtener_ticks();
+/*I. Funcion que devuelve la direccion de la pagina compartida con el nucleo */
+int sis_obtener_pagina();
+/*I. Funcion que bloquea el mutex esperando como mucho unos milisegundos */
+int sis_lock_timeout();
+/*I. Funcion que crea un mutex esperando como mucho unos milisegundos */
+int sis_crear_mutex_timeout();
+/*I. Funcion que arma (o desarma) la alarma del proceso */
+int sis_alarma();
+/*I. Funcion que espera a que venza la alarma del proceso */
+int sis_esperar_alarma();
+
+/*
+ * Operaciones de las clases de planificacion
+ */
+void fifo_encolar(BCP *proc);
+void fifo_desencolar(BCP *proc);
+BCP * fifo_primero();
+void fifo_tick(unsigned int n, BCP *actual);
+int fifo_despertar(BCP *proc, BCP *actual);
+unsigned int fifo_rodaja(BCP *proc);
+void rr_encolar(BCP *proc);
+void rr_desencolar(BCP *proc);
+BCP * rr_primero();
+void rr_tick(unsigned int n, BCP *actual);
+int rr_despertar(BCP *proc, BCP *actual);
+unsigned int rr_rodaja(BCP *proc);
+void grupos_encolar(BCP *proc);
+void grupos_desencolar(BCP *proc);
+BCP * grupos_primero();
+void grupos_tick(unsigned int n, BCP *actual);
+int grupos_despertar(BCP *proc, BCP *actual);
+unsigned int grupos_rodaja(BCP *proc);
+void rafaga_encolar(BCP *proc);
+void rafaga_tick(unsigned int n, BCP *actual);
+int rafaga_despertar(BCP *proc, BCP *actual);
+unsigned int rafaga_rodaja(BCP *proc);
+void mlfq_encolar(BCP *proc);
+void mlfq_desencolar(BCP *proc);
+BCP * mlfq_primero();
+void mlfq_tick(unsigned int n, BCP *actual);
+int mlfq_despertar(BCP *proc, BCP *actual);
+unsigned int mlfq_rodaja(BCP *proc);
+int mlfq_prioridad(BCP *proc, BCP *actual);
+void mont_desencolar(BCP *proc);
+BCP * mont_primero();
+void cfs_encolar(BCP *proc);
+void cfs_tick(unsigned int n, BCP *actual);
+int cfs_despertar(BCP *proc, BCP *actual);
+unsigned int cfs_rodaja(BCP *proc);
+void stride_encolar(BCP *proc);
+void stride_tick(unsigned int n, BCP *actual);
+int stride_despertar(BCP *proc, BCP *actual);
+unsigned int stride_rodaja(BCP *proc);
+int prioridad_sin_efecto(BCP *proc, BCP *actual);
+
+/*
+ * Variable global que contiene las clases de planificacion (indexada por
+ * POL_*) y la que esta en uso. fifo sustituye al antiguo arbol minikernel/
+ * y rr al planificador original de este, para comparar politicas con el
+ * mismo binario
+ */
+clase_planificacion tabla_clases[NUM_POLITICAS]={
+	{"mlfq", mlfq_encolar, mlfq_desencolar, mlfq_primero, mlfq_tick,
+		mlfq_despertar, mlfq_rodaja, mlfq_prioridad},
+	{"cfs", cfs_encolar, mont_desencolar, mont_primero, cfs_tick,
+		cfs_despertar, cfs_rodaja, prioridad_sin_efecto},
+	{"stride", stride_encolar, mont_desencolar, mont_primero, stride_tick,
+		stride_despertar, stride_rodaja, prioridad_sin_efecto},
+	{"fifo", fifo_encolar, fifo_desencolar, fifo_primero, fifo_tick,
+		fifo_despertar, fifo_rodaja, prioridad_sin_efecto},
+	{"rr", rr_encolar, rr_desencolar, rr_primero, rr_tick,
+		rr_despertar, rr_rodaja, prioridad_sin_efecto},
+	{"grupos", grupos_encolar, grupos_desencolar, grupos_primero, grupos_tick,
+		grupos_despertar, grupos_rodaja, prioridad_sin_efecto},
+	{"rafaga", rafaga_encolar, mont_desencolar, mont_primero, rafaga_tick,
+		rafaga_despertar, rafaga_rodaja, prioridad_sin_efecto}};
+
+clase_planificacion *clase=&tabla_clases[POLITICA];
 
 /*
  * Variable global que contiene las rutinas que realizan cada llamada
@@ -156,7 +641,31 @@ servicio tabla_servicios[NSERVICIOS]={
 					{sis_abrir_mutex},
 					{sis_lock},
 					{sis_unlock},
-					{sis_cerrar_mutex}};
+					{sis_cerrar_mutex},
+					{sis_fijar_prioridad},
+					{sis_fijar_nice},
+					{sis_fijar_tickets},
+					{sis_transferir_tickets},
+					{sis_fijar_plazo},
+					{sis_obtener_info_cpu},
+					{sis_volcar_traza},
+					{sis_ceder},
+					{sis_ceder_a},
+					{sis_obtener_carga},
+					{sis_fijar_politica},
+					{sis_fijar_aviso_expulsion},
+					{sis_crear_grupo},
+					{sis_unirse_grupo},
+					{sis_registrar_agente},
+					{sis_esperar_eventos},
+					{sis_dormir_ms},
+					{sis_dormir_hasta},
+					{sis_obtener_ticks},
+					{sis_obtener_pagina},
+					{sis_lock_timeout},
+					{sis_crear_mutex_timeout},
+					{sis_alarma},
+					{sis_esperar_alarma}};
 
 #endif /* _KERNEL_H */
 
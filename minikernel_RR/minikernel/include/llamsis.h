@@ -19,7 +19,7 @@
 #define _LLAMSIS_H
 
 /* Numero de llamadas disponibles */
-#define NSERVICIOS 10
+#define NSERVICIOS 34
 
 #define CREAR_PROCESO 0
 #define TERMINAR_PROCESO 1
@@ -31,6 +31,30 @@
 #define LOCK 7
 #define UNLOCK 8
 #define CERRAR_MUTEX 9
+#define FIJAR_PRIORIDAD 10
+#define FIJAR_NICE 11
+#define FIJAR_TICKETS 12
+#define TRANSFERIR_TICKETS 13
+#define FIJAR_PLAZO 14
+#define OBTENER_INFO_CPU 15
+#define VOLCAR_TRAZA 16
+#define CEDER 17
+#define CEDER_A 18
+#define OBTENER_CARGA 19
+#define FIJAR_POLITICA 20
+#define FIJAR_AVISO_EXPULSION 21
+#define CREAR_GRUPO 22
+#define UNIRSE_GRUPO 23
+#define REGISTRAR_AGENTE 24
+#define ESPERAR_EVENTOS 25
+#define DORMIR_MS 26
+#define DORMIR_HASTA 27
+#define OBTENER_TICKS 28
+#define OBTENER_PAGINA 29
+#define LOCK_TIMEOUT 30
+#define CREAR_MUTEX_TIMEOUT 31
+#define ALARMA 32
+#define ESPERAR_ALARMA 33
 
 #endif /* _LLAMSIS_H */
 
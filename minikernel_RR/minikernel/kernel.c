@@ -15,6 +15,7 @@
 
 #include "kernel.h"	/* Contiene defs. usadas por este modulo */
 #include "string.h"
+#include <stdlib.h>	/* getenv y malloc */
 /*
  *
  * Funciones relacionadas con la tabla de procesos:
@@ -62,6 +63,7 @@ static void insertar_ultimo(lista_BCPs *lista, BCP * proc){
 		lista->ultimo->siguiente=proc;
 	lista->ultimo= proc;
 	proc->siguiente=NULL;
+	lista->n++;
 }
 
 /*
@@ -72,6 +74,7 @@ static void eliminar_primero(lista_BCPs *lista){
 	if (lista->ultimo==lista->primero)
 		lista->ultimo=NULL;
 	lista->primero=lista->primero->siguiente;
+	lista->n--;
 }
 
 /*
@@ -89,10 +92,690 @@ static void eliminar_elem(lista_BCPs *lista, BCP * proc){
 			if (lista->ultimo==paux->siguiente)
 				lista->ultimo=paux;
 			paux->siguiente=paux->siguiente->siguiente;
+			lista->n--;
 		}
 	}
 }
 
+/*
+ *
+ * Funciones que facilitan el manejo de los monticulos de BCPs
+ *	insertar_mont eliminar_mont primero_mont
+ *
+ */
+
+/*
+ * Intercambia dos posiciones del monticulo actualizando la posicion
+ * guardada en cada BCP.
+ */
+static void intercambiar_mont(monticulo_BCPs *mont, int i, int j){
+	BCP *paux=mont->elem[i];
+
+	mont->elem[i]=mont->elem[j];
+	mont->elem[j]=paux;
+	mont->elem[i]->pos_mont=i;
+	mont->elem[j]->pos_mont=j;
+}
+
+/*
+ * Sube el elemento de la posicion i mientras su clave sea menor que la
+ * de su padre.
+ */
+static void subir_mont(monticulo_BCPs *mont, int i){
+	int padre;
+
+	for ( ; i>0; i=padre) {
+		padre=(i-1)/2;
+		if (mont->elem[i]->clave>=mont->elem[padre]->clave)
+			break;
+		intercambiar_mont(mont, i, padre);
+	}
+}
+
+/*
+ * Baja el elemento de la posicion i mientras alguno de sus hijos tenga
+ * una clave menor.
+ */
+static void bajar_mont(monticulo_BCPs *mont, int i){
+	int menor, hijo;
+
+	for (;;) {
+		menor=i;
+		hijo=2*i+1;
+		if (hijo<mont->n && mont->elem[hijo]->clave<mont->elem[menor]->clave)
+			menor=hijo;
+		hijo++;
+		if (hijo<mont->n && mont->elem[hijo]->clave<mont->elem[menor]->clave)
+			menor=hijo;
+		if (menor==i)
+			return;
+		intercambiar_mont(mont, i, menor);
+		i=menor;
+	}
+}
+
+/*
+ * Inserta un BCP en el monticulo con la clave indicada.
+ */
+static void insertar_mont(monticulo_BCPs *mont, BCP * proc,
+			unsigned long long clave){
+	proc->clave=clave;
+	proc->pos_mont=mont->n;
+	mont->elem[mont->n++]=proc;
+	subir_mont(mont, proc->pos_mont);
+}
+
+/*
+ * Elimina un determinado BCP del monticulo.
+ */
+static void eliminar_mont(monticulo_BCPs *mont, BCP * proc){
+	int i=proc->pos_mont;
+
+	if (i!=--mont->n) {
+		intercambiar_mont(mont, i, mont->n);
+		subir_mont(mont, i);
+		bajar_mont(mont, i);
+	}
+}
+
+/*
+ * Devuelve el BCP de menor clave sin sacarlo del monticulo.
+ */
+static BCP * primero_mont(monticulo_BCPs *mont){
+	return (mont->n>0)?mont->elem[0]:NULL;
+}
+
+/*
+ *
+ * Funciones de la traza del planificador
+ *	trazar volcar_traza
+ *
+ */
+
+/*
+ * Registra un evento en el buffer circular. No formatea nada: solo copia
+ * cuatro campos, para poder usarse en los caminos calientes.
+ */
+static void trazar(int tipo, int proc, int dato){
+	int nivel=fijar_nivel_int(NIVEL_3);
+	evento_traza *ev=&traza[n_traza&(TAM_TRAZA-1)];
+
+	ev->tick=ticks_sistema;
+	ev->tipo=tipo;
+	ev->proc=proc;
+	ev->dato=dato;
+	n_traza++;
+	fijar_nivel_int(nivel);
+}
+
+/*
+ * Escribe los eventos guardados, del mas antiguo al mas reciente, y vacia
+ * el buffer. Cada linea es "TRZ tick tipo proc dato"; la cabecera indica
+ * la frecuencia del reloj y los eventos perdidos por desbordamiento. El
+ * fichero herramientas/traza_json.c lo convierte al formato de Chrome.
+ */
+static void volcar_traza(){
+	int nivel=fijar_nivel_int(NIVEL_3);
+	unsigned int i, primero=0;
+	evento_traza *ev;
+
+	if (n_traza>TAM_TRAZA)
+		primero=n_traza-TAM_TRAZA;
+	printk("TRZ INICIO %d %d\n", TICK, primero);
+	for (i=primero; i<n_traza; i++) {
+		ev=&traza[i&(TAM_TRAZA-1)];
+		printk("TRZ %llu %d %d %d\n", ev->tick, ev->tipo, ev->proc, ev->dato);
+	}
+	printk("TRZ FIN\n");
+	n_traza=0;
+	fijar_nivel_int(nivel);
+}
+
+/*
+ * Agente de planificacion. Prototipo de la funcion definida junto al
+ * resto de funciones del agente
+ */
+static void publicar_evento(int tipo, BCP * proc);
+
+/*
+ * Prototipo de la funcion definida junto al resto de funciones de la
+ * rueda de temporizadores
+ */
+static int cancelar_temporizador(temporizador *t);
+
+/*
+ *
+ * Funciones que manejan la cola de listos
+ *	insertar_listo eliminar_listo primer_listo
+ *
+ *	Tiempo real: monticulo ordenado por plazo absoluto, por delante de
+ *	todo lo demas. Cada proceso es ademas de una clase: los de la clase
+ *	normal los gestiona la clase de planificacion en uso (ver sus
+ *	funciones) y los de las clases FIFO, LOTE y OCIOSA van a una lista
+ *	por orden de llegada; FIFO se atiende antes que la normal y LOTE y
+ *	OCIOSA despues
+ *
+ * NOTA: DEBEN LLAMARSE CON EL NIVEL DE INTERRUPCION A NIVEL_3
+ */
+
+/*
+ * EDF. Abre un nuevo periodo para un proceso de tiempo real que empieza
+ * en el tick indicado.
+ */
+static void nuevo_periodo_rt(BCP * proc, unsigned long long inicio){
+	proc->rt_presupuesto=proc->rt_ejecucion;
+	proc->rt_plazo_abs=inicio+proc->rt_plazo;
+	proc->rt_activacion=inicio+proc->rt_periodo;
+}
+
+/*
+ * Devuelve el proceso en ejecucion, o NULL si no lo hay (tampoco mientras
+ * se espera una interrupcion, aunque el anterior ya este despierto en la
+ * cola).
+ */
+static BCP * en_ejecucion(){
+	if (en_espera || p_proc_actual==NULL || p_proc_actual->estado!=LISTO)
+		return NULL;
+	return p_proc_actual;
+}
+
+/*
+ * Devuelve el proceso en ejecucion si es de la clase normal (gestionada
+ * por la clase de planificacion en uso), o NULL si no lo hay.
+ */
+static BCP * actual_normal(){
+	BCP *actual=en_ejecucion();
+
+	if (actual==NULL || actual->tiempo_real || actual->clase_proc!=CLASE_NORMAL)
+		return NULL;
+	return actual;
+}
+
+/*
+ * Orden en el que se atiende a un proceso segun su clase (0 el primero).
+ */
+static int rango_clase(BCP * proc){
+	if (proc->tiempo_real)
+		return 0;
+	switch (proc->clase_proc) {
+	case CLASE_FIFO:
+		return 1;
+	case CLASE_NORMAL:
+		return 2;
+	case CLASE_LOTE:
+		return 3;
+	default:
+		return 4;
+	}
+}
+
+/*
+ * Devuelve la lista de listos de la clase de un proceso, o NULL si es de
+ * la clase normal.
+ */
+static lista_BCPs * lista_clase(BCP * proc){
+	switch (proc->clase_proc) {
+	case CLASE_FIFO:
+		return &lista_clase_fifo;
+	case CLASE_LOTE:
+		return &lista_clase_lote;
+	case CLASE_OCIOSA:
+		return &lista_clase_ociosa;
+	default:
+		return NULL;
+	}
+}
+
+/*
+ * Si el proceso que pasa a listo es de una clase que se atiende antes que
+ * la del proceso en ejecucion se activa la int SW para expulsar a este en
+ * cuanto sea seguro; entre dos de tiempo real EDF decide el plazo. Los de
+ * la clase LOTE nunca expulsan.
+ */
+static void expulsar_por_clase(BCP * proc){
+	BCP *actual=en_ejecucion();
+
+	if (actual==NULL || proc==actual ||
+			(!proc->tiempo_real && proc->clase_proc==CLASE_LOTE))
+		return;
+	if (rango_clase(proc)<rango_clase(actual) ||
+			(proc->tiempo_real && actual->tiempo_real &&
+			 proc->rt_plazo_abs<actual->rt_plazo_abs))
+		activar_int_SW();
+}
+
+/*
+ * Cierra la rafaga del proceso que deja la UCP (al bloquearse, ceder o ser
+ * expulsado) y la incorpora a su media movil. Se llama antes de volver a
+ * insertarlo en una cola, ya que la rafaga prevista puede ser su clave.
+ */
+static void cerrar_rafaga(BCP * proc){
+	unsigned int rafaga=(unsigned int)(ticks_sistema-proc->tick_rafaga);
+
+	proc->cpu.ultima_rafaga=rafaga;
+	proc->cpu.rafaga_prevista=(ALFA_RAFAGA*rafaga*FIJO_RAFAGA+
+		(8-ALFA_RAFAGA)*proc->cpu.rafaga_prevista)/8;
+}
+
+/*
+ * Mete un BCP en la cola de listos que le toca y expulsa al proceso en
+ * ejecucion si es de una clase que va despues. No toca su contabilidad:
+ * sirve tanto para insertar_listo como para recolocar en la cola a un
+ * proceso que ya esta en ella (tras sacarlo con eliminar_listo y cambiar
+ * su prioridad, nivel o clase).
+ */
+static void encolar_listo(BCP * proc){
+	lista_BCPs *lista;
+
+	if (proc->tiempo_real)
+		insertar_mont(&monticulo_rt, proc, proc->rt_plazo_abs);
+	else if ((lista=lista_clase(proc))!=NULL)
+		insertar_ultimo(lista, proc);
+	else
+		clase->encolar(proc);
+	expulsar_por_clase(proc);
+}
+
+/*
+ * Inserta en la cola de listos un BCP que entra en ella (nuevo, que se
+ * desbloquea o que deja la UCP). Si se desbloquea, la clase lo ajusta
+ * antes y, con expulsion al despertar, decide si es mas urgente que el
+ * proceso en ejecucion. Un proceso de la clase normal nunca expulsa a uno
+ * de tiempo real.
+ */
+static void insertar_listo(BCP * proc){
+	int despierta=(proc->estado==BLOQUEADO);
+
+	//Si es el proceso en ejecucion que vuelve a la cola acaba su rafaga:
+	if (proc==en_ejecucion())
+		cerrar_rafaga(proc);
+
+	if (despierta) {
+		//Si despierta con el plazo vencido empieza un periodo nuevo:
+		if (proc->tiempo_real) {
+			if (ticks_sistema>=proc->rt_plazo_abs)
+				nuevo_periodo_rt(proc, ticks_sistema);
+		}
+		else if (lista_clase(proc)==NULL &&
+				clase->despertar(proc, actual_normal()) && EXPULSION_DESPERTAR)
+			activar_int_SW();
+	}
+	encolar_listo(proc);
+	//C. Empieza a esperar en la cola:
+	proc->tick_listo=ticks_sistema;
+	proc->tick_edad=ticks_sistema;
+	if (despierta)
+		trazar(TRZ_DESPERTAR, proc->id, 0);
+	proc->estado=LISTO;
+	if (despierta)
+		publicar_evento(EVT_DESPERTAR, proc);
+}
+
+/*
+ * Elimina un BCP de la cola de listos.
+ */
+static void eliminar_listo(BCP * proc){
+	lista_BCPs *lista;
+
+	if (proc->tiempo_real)
+		eliminar_mont(&monticulo_rt, proc);
+	else if ((lista=lista_clase(proc))!=NULL)
+		eliminar_elem(lista, proc);
+	else
+		clase->desencolar(proc);
+}
+
+/*
+ * Devuelve el siguiente BCP a ejecutar sin sacarlo de la cola: el proceso
+ * de tiempo real de plazo mas cercano si lo hay, si no el primero de la
+ * clase FIFO, el que elija la clase en uso para los normales, el primero
+ * de la clase LOTE y por ultimo el de la clase OCIOSA.
+ */
+static BCP * primer_listo(){
+	BCP *proc;
+
+	if (monticulo_rt.n>0)
+		return primero_mont(&monticulo_rt);
+	if (lista_clase_fifo.primero)
+		return lista_clase_fifo.primero;
+	if ((proc=clase->primero())!=NULL)
+		return proc;
+	if (lista_clase_lote.primero)
+		return lista_clase_lote.primero;
+	return lista_clase_ociosa.primero;
+}
+
+/*
+ *
+ * Funciones del agente de planificacion en modo usuario
+ *	publicar_evento soltar_agente decision_agente vigilar_agente
+ *
+ *	El agente recibe los eventos de planificacion por un anillo
+ *	compartido y deja en el su decision, que el planificador usa si es
+ *	valida. Si tarda mas de PLAZO_AGENTE ticks en atender un evento o
+ *	ejecuta seguido mas de PLAZO_AGENTE ticks se le retira y se vuelve a
+ *	planificar solo con la clase en uso.
+ *
+ * NOTA: DEBEN LLAMARSE CON EL NIVEL DE INTERRUPCION A NIVEL_3
+ */
+
+/*
+ * Publica un evento de un proceso en el anillo del agente (los del propio
+ * agente no) y lo despierta si estaba esperando eventos.
+ */
+static void publicar_evento(int tipo, BCP * proc){
+	evento_agente *evt;
+
+	if (agente==NULL || proc==agente)
+		return;
+	if (anillo->cabeza-anillo->cola>=TAM_ANILLO_AGENTE)
+		anillo->perdidos++;
+	else {
+		evt=&anillo->eventos[anillo->cabeza%TAM_ANILLO_AGENTE];
+		evt->tipo=tipo;
+		evt->proc=proc->id;
+		evt->tick=(unsigned int)ticks_sistema;
+		anillo->cabeza++;
+	}
+	if (agente->estado==BLOQUEADO && lista_agente.primero==agente) {
+		eliminar_elem(&lista_agente, agente);
+		insertar_listo(agente);
+	}
+}
+
+/*
+ * Retira al agente, que vuelve a ser un proceso normal. Si estaba
+ * esperando eventos se le despierta; si esta en ejecucion se le da por
+ * vencida la rodaja.
+ */
+static void soltar_agente(const char *motivo){
+	BCP *proc=agente;
+
+	printk("\x1b[31m""[AGENTE] - Se retira el agente %d: %s\n""\x1b[0m", proc->id, motivo);
+	agente=NULL;
+	anillo=NULL;
+	if (proc->estado==BLOQUEADO && lista_agente.primero==proc) {
+		eliminar_elem(&lista_agente, proc);
+		proc->clase_proc=CLASE_NORMAL;
+		insertar_listo(proc);
+	}
+	else if (proc!=p_proc_actual && proc->estado==LISTO) {
+		eliminar_listo(proc);
+		proc->clase_proc=CLASE_NORMAL;
+		encolar_listo(proc);
+	}
+	else {
+		proc->clase_proc=CLASE_NORMAL;
+		proc->fin_rodaja=ticks_sistema;
+	}
+}
+
+/*
+ * Devuelve el proceso que ha decidido el agente si esta listo y es de la
+ * misma clase que el que elegiria el planificador (primero), o NULL. Una
+ * decision que no se puede usar por haber listo uno de una clase que va
+ * antes se guarda para mas tarde; las que no son validas se descartan.
+ */
+static BCP * decision_agente(BCP * primero){
+	int id;
+	BCP *proc;
+
+	if (agente==NULL || (id=anillo->decision)<0)
+		return NULL;
+	if (id>=MAX_PROC || tabla_procs[id].estado!=LISTO) {
+		anillo->decision=-1;
+		return NULL;
+	}
+	proc=&tabla_procs[id];
+	if (rango_clase(proc)!=rango_clase(primero))
+		return NULL;
+	anillo->decision=-1;
+	return proc;
+}
+
+/*
+ * Retira al agente si el evento mas antiguo sin atender tiene mas de
+ * PLAZO_AGENTE ticks, si ejecuta seguido mas de PLAZO_AGENTE ticks o si
+ * ha estropeado el anillo.
+ */
+static void vigilar_agente(){
+	unsigned int pendientes;
+
+	if (agente==NULL)
+		return;
+	pendientes=anillo->cabeza-anillo->cola;
+	if (pendientes>TAM_ANILLO_AGENTE)
+		soltar_agente("anillo no valido");
+	else if (pendientes>0 && ticks_sistema-
+			anillo->eventos[anillo->cola%TAM_ANILLO_AGENTE].tick>PLAZO_AGENTE)
+		soltar_agente("no atiende los eventos");
+	else if (agente==en_ejecucion() &&
+			ticks_sistema-agente->tick_rafaga>PLAZO_AGENTE)
+		soltar_agente("no cede la UCP");
+}
+
+/*
+ *
+ * Funciones de la cola multinivel con realimentacion (MLFQ)
+ *	degradar promocionar boost_prioridades
+ *
+ * NOTA: DEBEN LLAMARSE CON EL NIVEL DE INTERRUPCION A NIVEL_3
+ */
+
+/*
+ * Baja de nivel un proceso que ha agotado su rodaja. No debe estar en la
+ * cola de listos.
+ */
+static void degradar(BCP * proc){
+	if (proc->nivel<NUM_PRIORIDADES-1)
+		proc->nivel++;
+}
+
+/*
+ * Sube de nivel un proceso que se bloquea antes de agotar su rodaja, sin
+ * pasar de su prioridad base. No debe estar en la cola de listos.
+ */
+static void promocionar(BCP * proc){
+	if (proc->nivel>proc->prioridad)
+		proc->nivel--;
+}
+
+/*
+ * Devuelve todos los procesos degradados a su prioridad base para que no
+ * sufran inanicion. Los que estan por encima por envejecimiento no se tocan.
+ */
+static void boost_prioridades(){
+	int i;
+	BCP *proc;
+
+	for (i=0; i<MAX_PROC; i++) {
+		proc=&tabla_procs[i];
+		if (proc->estado==NO_USADA || proc->nivel<=proc->prioridad)
+			continue;
+		if (proc!=p_proc_actual && proc->estado==LISTO) {
+			eliminar_listo(proc);
+			proc->nivel=proc->prioridad;
+			proc->tick_edad=ticks_sistema;
+			encolar_listo(proc);
+		}
+		else
+			proc->nivel=proc->prioridad;
+	}
+}
+
+/*
+ * Envejecimiento: el proceso que lleva ESPERA_ENVEJECIMIENTO ticks en la
+ * cola de un nivel sin ejecutar sube al nivel superior, aunque quede por
+ * encima de su prioridad base, para que la carga de los niveles mas
+ * urgentes no le cause inanicion. Se recorre cada nivel entero: las
+ * listas no estan ordenadas por el tick desde el que se envejece, ya que
+ * un proceso recolocado (p.ej. al cambiar su prioridad) conserva su edad.
+ * Un proceso que sube va a un nivel ya recorrido, asi que sube uno como
+ * mucho en cada llamada.
+ */
+static void envejecer(){
+	int i;
+	BCP *proc, *siguiente;
+
+	for (i=1; i<NUM_PRIORIDADES; i++) {
+		for (proc=lista_listos[i].primero; proc!=NULL; proc=siguiente) {
+			siguiente=proc->siguiente;
+			if (ticks_sistema-proc->tick_edad<ESPERA_ENVEJECIMIENTO)
+				continue;
+			eliminar_listo(proc);
+			proc->nivel=i-1;
+			proc->tick_edad=ticks_sistema;
+			encolar_listo(proc);
+		}
+	}
+}
+
+/*
+ *
+ * Funciones de los grupos de procesos
+ *	iniciar_tabla_grupos entrar_grupo salir_grupo soltar_grupos_creados
+ *
+ */
+
+/*
+ * Inicia la tabla de grupos con el grupo 0, al que pertenece init.
+ */
+static void iniciar_tabla_grupos(){
+	int i;
+
+	for (i=0; i<MAX_GRUPOS; i++)
+		tabla_grupos[i].usado=0;
+	tabla_grupos[0].usado=1;
+	tabla_grupos[0].peso=PESO_GRUPO_DEFECTO;
+	tabla_grupos[0].zancada=STRIDE1/PESO_GRUPO_DEFECTO;
+	tabla_grupos[0].pase=0;
+	tabla_grupos[0].n_procs=0;
+	tabla_grupos[0].creador=NULL;
+}
+
+/*
+ * Apunta un proceso en un grupo. No debe estar en la cola de listos.
+ */
+static void entrar_grupo(BCP * proc, int id){
+	proc->grupo=id;
+	tabla_grupos[id].n_procs++;
+}
+
+/*
+ * Saca un proceso de su grupo, que se libera si se queda sin procesos
+ * (salvo el 0). No debe estar en la cola de listos.
+ */
+static void salir_grupo(BCP * proc){
+	grupo *g=&tabla_grupos[proc->grupo];
+
+	g->n_procs--;
+	if (g->n_procs==0 && proc->grupo!=0)
+		g->usado=0;
+}
+
+/*
+ * Al terminar un proceso se liberan los grupos que creo y en los que nunca
+ * llego a entrar nadie (si no se quedarian ocupados para siempre); los
+ * demas se liberan al salir su ultimo proceso.
+ */
+static void soltar_grupos_creados(BCP * proc){
+	int i;
+
+	for (i=1; i<MAX_GRUPOS; i++) {
+		if (!tabla_grupos[i].usado || tabla_grupos[i].creador!=proc)
+			continue;
+		tabla_grupos[i].creador=NULL;
+		if (tabla_grupos[i].n_procs==0)
+			tabla_grupos[i].usado=0;
+	}
+}
+
+/*
+ *
+ * Funciones del reparto proporcional por tickets (STRIDE)
+ *	cambiar_tickets prestar_tickets devolver_tickets anular_prestamos
+ *	retirar_prestamos_mutex prestar_al_propietario
+ *
+ */
+
+/*
+ * Fija los tickets de un proceso recalculando su zancada. Su pase no
+ * cambia, por lo que no hace falta recolocarlo en la cola de listos.
+ */
+static void cambiar_tickets(BCP * proc, unsigned int tickets){
+	if (tickets==0)
+		tickets=1;
+	proc->tickets=tickets;
+	proc->zancada=STRIDE1/tickets;
+}
+
+/*
+ * Presta los tickets de un proceso al proceso indicado mientras el primero
+ * esta bloqueado esperandole (p.ej. en un mutex que este posee).
+ */
+static void prestar_tickets(BCP * proc, int id){
+	BCP *dest=&tabla_procs[id];
+
+	if (dest==proc || proc->prestado_a!=-1)
+		return;
+	proc->prestado_a=id;
+	proc->tickets_prestados=proc->tickets;
+	cambiar_tickets(dest, dest->tickets+proc->tickets);
+}
+
+/*
+ * Recupera los tickets que un proceso tuviera prestados.
+ */
+static void devolver_tickets(BCP * proc){
+	BCP *dest;
+
+	if (proc->prestado_a==-1)
+		return;
+	dest=&tabla_procs[proc->prestado_a];
+	if (dest->tickets>proc->tickets_prestados)
+		cambiar_tickets(dest, dest->tickets-proc->tickets_prestados);
+	else
+		cambiar_tickets(dest, 1);
+	proc->prestado_a=-1;
+}
+
+/*
+ * Anula los prestamos hechos al proceso actual cuando este termina: los
+ * tickets desaparecen con el y los prestamistas no deben devolverlos.
+ */
+static void anular_prestamos(){
+	int i;
+
+	for (i=0; i<MAX_PROC; i++)
+		if (tabla_procs[i].estado!=NO_USADA &&
+				tabla_procs[i].prestado_a==p_proc_actual->id)
+			tabla_procs[i].prestado_a=-1;
+}
+
+/*
+ * El propietario del mutex des lo suelta: los que siguen esperando en el
+ * recuperan los tickets que le prestaban. Se llama a nivel 3.
+ */
+static void retirar_prestamos_mutex(int des){
+	BCP *proc;
+
+	for (proc=tabla_mutexs[des].procesos_bloqueados_lock.primero; proc;
+			proc=proc->siguiente)
+		devolver_tickets(proc);
+}
+
+/*
+ * El mutex des tiene nuevo propietario: los que siguen esperando en el le
+ * prestan sus tickets. Se llama a nivel 3.
+ */
+static void prestar_al_propietario(int des){
+	BCP *proc;
+
+	for (proc=tabla_mutexs[des].procesos_bloqueados_lock.primero; proc;
+			proc=proc->siguiente)
+		prestar_tickets(proc, tabla_mutexs[des].id_proc_propietario);
+}
+
 /*
  *
  * Funciones relacionadas con la planificacion
@@ -100,149 +783,1100 @@ static void eliminar_elem(lista_BCPs *lista, BCP * proc){
  */
 
 /*
- * Espera a que se produzca una interrupcion
+ * Tick dinamico. Prototipos de funciones definidas junto al tratamiento
+ * de la interrupcion de reloj
+ */
+static void entrar_reposo();
+static void salir_reposo();
+
+/*
+ * Espera a que se produzca una interrupcion
+ */
+static void espera_int(){
+	int nivel;
+
+	// printk("-> NO HAY LISTOS. ESPERA INT\n");
+
+	/* Con tick dinamico el reloj solo interrumpe cuando hace falta */
+	if (TICK_DINAMICO)
+		entrar_reposo();
+
+	/* Baja al m�nimo el nivel de interrupci�n mientras espera */
+	en_espera=1;
+	nivel=fijar_nivel_int(NIVEL_1);
+	halt();
+	fijar_nivel_int(nivel);
+	en_espera=0;
+
+	if (TICK_DINAMICO)
+		salir_reposo();
+}
+
+/*
+ * Saca de la cola de listos al proceso que va a pasar a ejecutar.
+ */
+static void elegir_listo(BCP *proc){
+	unsigned int espera=(unsigned int)(ticks_sistema-proc->tick_listo);
+
+	eliminar_listo(proc);
+	//C. Se acumula lo que ha esperado en la cola de listos:
+	proc->cpu.ticks_espera+=espera;
+	if (espera>proc->cpu.espera_maxima)
+		proc->cpu.espera_maxima=espera;
+}
+
+/*
+ * Funci�n de planificacion: elige el siguiente proceso (ver primer_listo)
+ * y lo saca de la cola de listos. El proceso en ejecucion nunca esta en la
+ * cola.
+ */
+static BCP * planificador(){
+	BCP *proc, *elegido;
+
+	while ((proc=primer_listo())==NULL)
+		espera_int();		/* No hay nada que hacer */
+	//El agente de planificacion puede elegir otro de la misma clase:
+	if ((elegido=decision_agente(proc))!=NULL)
+		proc=elegido;
+	elegir_listo(proc);
+	return proc;
+}
+
+/*
+ * Fija el tick en el que vence la rodaja del proceso que se acaba de
+ * elegir segun su clase; sin limite si no tiene rodaja.
+ */
+static void iniciar_rodaja(BCP *proc){
+	unsigned int rodaja;
+
+	switch (proc->clase_proc) {
+	case CLASE_FIFO:
+		rodaja=0;
+		break;
+	case CLASE_LOTE:
+		rodaja=RODAJA_LOTE;
+		break;
+	case CLASE_OCIOSA:
+		rodaja=TICKS_POR_RODAJA;
+		break;
+	default:
+		rodaja=clase->rodaja(proc);
+	}
+
+	if (rodaja>0)
+		proc->fin_rodaja=ticks_sistema+rodaja;
+	else
+		proc->fin_rodaja=(unsigned long long)-1;
+	proc->prorrogado=0;
+}
+
+/*
+ * Actualiza la pagina compartida con los procesos. Se llama a nivel 3.
+ */
+static void actualizar_pagina(){
+	pagina_compartida.secuencia++;
+	pagina_compartida.ticks=ticks_sistema;
+	pagina_compartida.id_actual=p_proc_actual?p_proc_actual->id:-1;
+	pagina_compartida.secuencia++;
+}
+
+/*
+ * Gestor de cambio de proceso. Si lista_destino no es NULL el proceso
+ * actual se inserta en ella (para devolverlo a la cola de listos se debe
+ * usar antes insertar_listo). Si se indica siguiente (que debe estar en la
+ * cola de listos) se le cede directamente lo que queda de la rodaja en
+ * lugar de llamar al planificador. cede indica que el proceso deja la UCP
+ * por voluntad propia sin bloquearse (ceder y ceder_a).
+ */
+static void cambioProcesoA(lista_BCPs *lista_destino, BCP *siguiente, int cede) {
+
+	//Guardamos el proceso actual:
+	BCP * p_proc_anterior = p_proc_actual;
+	//Elevamos el nivel de int:
+	int level=fijar_nivel_int(NIVEL_3);
+
+	//Si se bloquea acaba su rafaga (si vuelve a la cola ya lo ha hecho
+	//insertar_listo):
+	if (p_proc_anterior->estado==BLOQUEADO) {
+		cerrar_rafaga(p_proc_anterior);
+		publicar_evento(EVT_BLOQUEO, p_proc_anterior);
+	}
+
+	//Si se paso una lista se añade a ella:
+	if (lista_destino)
+		insertar_ultimo(lista_destino, p_proc_anterior);
+
+	if (siguiente) {
+		//Cesion dirigida: hereda lo que queda de la rodaja (al menos un tick):
+		elegir_listo(siguiente);
+		p_proc_actual = siguiente;
+		if (p_proc_anterior->fin_rodaja>ticks_sistema)
+			p_proc_actual->fin_rodaja = p_proc_anterior->fin_rodaja;
+		else
+			p_proc_actual->fin_rodaja = ticks_sistema+1;
+		p_proc_actual->prorrogado = 0;
+	}
+	else {
+		//Llamamos al proximo proceso:
+		p_proc_actual = planificador(); 
+		iniciar_rodaja(p_proc_actual);
+	}
+	p_proc_actual->tick_rafaga = ticks_sistema;
+	actualizar_pagina();
+
+	//C. Bloquearse o ceder es dejar la UCP voluntariamente; la expulsion y
+	//el agotar el presupuesto de tiempo real no. Solo cuenta si realmente
+	//cambia de proceso:
+	if (p_proc_anterior->estado!=TERMINADO && p_proc_anterior!=p_proc_actual) {
+		if (cede || (p_proc_anterior->estado==BLOQUEADO &&
+				lista_destino!=&lista_rt_agotados))
+			p_proc_anterior->cpu.cambios_voluntarios++;
+		else
+			p_proc_anterior->cpu.cambios_involuntarios++;
+	}
+	
+	//Si el proceso ha terminado, se libera su pila:
+	contexto_t *contexto_aux;
+	if (p_proc_anterior->estado == TERMINADO) {
+		contexto_aux = NULL;
+		liberar_pila(p_proc_anterior->pila);
+	}
+	else {
+		//Si no se guarda el contexto:
+		contexto_aux=&(p_proc_anterior->contexto_regs);
+	}
+	
+	trazar(TRZ_CAMBIO, p_proc_anterior->id, p_proc_actual->id);
+	//Realizamos el cambio de contexto:
+	cambio_contexto(contexto_aux, &(p_proc_actual->contexto_regs));
+
+	//Volvemos al nivel original:
+	fijar_nivel_int(level); 
+}
+
+/*
+ * Cambio de proceso en el que el siguiente lo elige el planificador.
+ */
+static void cambioProceso(lista_BCPs *lista_destino) {
+	cambioProcesoA(lista_destino, NULL, 0);
+}
+
+/*
+ *
+ * Funcion auxiliar que termina proceso actual liberando sus recursos.
+ * Usada por llamada terminar_proceso y por rutinas que tratan excepciones
+ *
+ */
+static void liberar_proceso(){
+	BCP * p_proc_anterior;
+	int i;
+
+	//T. Si es el ultimo proceso el sistema parara al liberar su imagen:
+	//antes se vuelca la traza:
+	for (i=0; i<MAX_PROC; i++)
+		if (&tabla_procs[i]!=p_proc_actual && tabla_procs[i].estado!=NO_USADA)
+			break;
+	if (i==MAX_PROC)
+		volcar_traza();
+
+	liberar_imagen(p_proc_actual->info_mem); /* liberar mapa */
+
+	p_proc_actual->estado=TERMINADO;
+	//STRIDE. Los tickets prestados no sobreviven al proceso:
+	anular_prestamos();
+	salir_grupo(p_proc_actual);
+	soltar_grupos_creados(p_proc_actual);
+	int nivel=fijar_nivel_int(NIVEL_3);
+	//No debe quedar armado ningun temporizador que apunte al proceso:
+	cancelar_temporizador(&p_proc_actual->despertador);
+	cancelar_temporizador(&p_proc_actual->alarma);
+	if (p_proc_actual==titular_agente)
+		titular_agente=NULL;
+	if (p_proc_actual==agente)
+		soltar_agente("ha terminado");
+	else
+		publicar_evento(EVT_FIN, p_proc_actual);
+	fijar_nivel_int(nivel);
+	
+	//Se cambia el proceso sin guardar el contexto:
+	printk("\x1b[33m""#>\t""\x1b[0m""Liberado: %d\n", p_proc_actual->id);
+	cambioProceso(NULL);
+	
+    return; /* no deber�a llegar aqui */
+}
+
+/*
+ *
+ * Funciones relacionadas con el tratamiento de interrupciones
+ *	excepciones: exc_arit exc_mem
+ *	interrupciones de reloj: int_reloj
+ *	interrupciones del terminal: int_terminal
+ *	llamadas al sistemas: llam_sis
+ *	interrupciones SW: int_sw
+ *
+ */
+
+/*
+ * Tratamiento de excepciones aritmeticas
+ */
+static void exc_arit(){
+
+	if (!viene_de_modo_usuario())
+		panico("excepcion aritmetica cuando estaba dentro del kernel");
+
+
+	printk("\x1b[32m""-> EXCEPCION ARITMETICA EN PROC %d\n""\x1b[0m", p_proc_actual->id);
+	liberar_proceso();
+
+        return; /* no deber�a llegar aqui */
+}
+
+/*
+ * Tratamiento de excepciones en el acceso a memoria
+ */
+static void exc_mem(){
+
+	if (!viene_de_modo_usuario())
+		panico("excepcion de memoria cuando estaba dentro del kernel");
+
+
+	printk("\x1b[32m""-> EXCEPCION DE MEMORIA EN PROC %d\n""\x1b[0m", p_proc_actual->id);
+	liberar_proceso();
+
+        return; /* no deber�a llegar aqui */
+}
+
+/*
+ * Tratamiento de interrupciones de terminal
+ */
+static void int_terminal(){
+	char car;
+
+	car = leer_puerto(DIR_TERMINAL);
+	printk("\x1b[32m""-> TRATANDO INT. DE TERMINAL %c\n""\x1b[0m", car);
+
+        return;
+}
+
+/*RR. Función que comprueba si el proceso ha agotado su rodaja. Si vence
+  mientras el proceso avisa de que esta en una seccion critica se le
+  prorroga una sola vez PRORROGA_RODAJA ticks y se le pide que ceda la UCP
+  al salir de ella; si no lo hace se le expulsa al acabar la prorroga*/
+static int rodaja_agotada(BCP *proc){
+	if (ticks_sistema<proc->fin_rodaja)
+		return 0;
+	if (proc->aviso && proc->aviso->en_seccion && !proc->prorrogado) {
+		proc->prorrogado=1;
+		proc->aviso->ceder_pendiente=1;
+		proc->fin_rodaja=ticks_sistema+PRORROGA_RODAJA;
+		return 0;
+	}
+	return 1;
+}
+
+/*EDF. Función que descuenta el tick ejecutado del presupuesto del proceso actual*/
+static void actualizarPresupuesto(){
+	if (p_proc_actual->estado != LISTO)
+		return;
+	//Si agota su presupuesto debe esperar al siguiente periodo:
+	if (p_proc_actual->rt_presupuesto>0)
+		p_proc_actual->rt_presupuesto--;
+	if (p_proc_actual->rt_presupuesto==0)
+		activar_int_SW();
+}
+
+/*
+ * EDF. Devuelve a la cola de listos los procesos de tiempo real que
+ * agotaron su presupuesto y cuyo siguiente periodo ya ha empezado.
+ */
+static void reponer_presupuestos(){
+	BCP *proc=lista_rt_agotados.primero, *siguiente;
+
+	while (proc!=NULL) {
+		siguiente=proc->siguiente;
+		if (ticks_sistema>=proc->rt_activacion) {
+			eliminar_elem(&lista_rt_agotados, proc);
+			nuevo_periodo_rt(proc, proc->rt_activacion);
+			insertar_listo(proc);
+		}
+		proc=siguiente;
+	}
+}
+
+/*
+ *
+ * Funciones de las clases de planificacion (ver tabla_clases)
+ *	encolar desencolar primero tick despertar rodaja
+ *
+ *	POL_FIFO: lista unica por orden de llegada, sin rodaja
+ *	POL_RR: lista de interactivos por delante de la de resto, con rodaja
+ *	        segun la interactividad
+ *	POL_MLFQ: una lista por nivel y un mapa de bits de niveles no vacios
+ *	POL_CFS: monticulo ordenado por tiempo virtual
+ *	POL_STRIDE: monticulo ordenado por pase
+ *	POL_GRUPOS: una lista por grupo; se elige el grupo de menor pase
+ *	POL_RAFAGA: monticulo ordenado por rafaga prevista
+ *
+ * NOTA: DEBEN LLAMARSE CON EL NIVEL DE INTERRUPCION A NIVEL_3
+ */
+
+/*
+ * FIFO. Inserta un BCP al final de la lista de listos.
+ */
+void fifo_encolar(BCP * proc){
+	insertar_ultimo(&lista_fifo, proc);
+}
+
+/*
+ * FIFO. Elimina un BCP de la lista de listos.
+ */
+void fifo_desencolar(BCP * proc){
+	eliminar_elem(&lista_fifo, proc);
+}
+
+/*
+ * FIFO. Devuelve el primero de la lista de listos.
+ */
+BCP * fifo_primero(){
+	return lista_fifo.primero;
+}
+
+/*
+ * FIFO. Sin rodaja: el proceso solo deja la UCP si se bloquea, cede o
+ * llega uno de tiempo real.
+ */
+void fifo_tick(unsigned int n, BCP *actual){
+}
+
+/*
+ * FIFO. El que despierta va al final de la cola y nunca expulsa.
+ */
+int fifo_despertar(BCP * proc, BCP *actual){
+	return 0;
+}
+
+unsigned int fifo_rodaja(BCP * proc){
+	return 0;
+}
+
+/*
+ * RR. Un proceso es interactivo si se bloquea mas a menudo de lo que agota
+ * su rodaja.
+ */
+static int es_interactivo(BCP * proc){
+	return proc->interactividad>=UMBRAL_INTERACTIVO;
+}
+
+/*
+ * RR. Apunta que el proceso actual se bloquea en dormir o lock sin agotar
+ * la rodaja. Se lleva la cuenta con cualquier politica.
+ */
+static void sumar_interactividad(BCP * proc){
+	if (proc->interactividad<INTERACTIVIDAD_MAX)
+		proc->interactividad++;
+}
+
+/*
+ * RR. Los interactivos van a su propia lista, que se atiende antes. La
+ * interactividad solo cambia en ejecucion, asi que al desencolar sigue
+ * indicando la lista en la que esta.
+ */
+void rr_encolar(BCP * proc){
+	if (es_interactivo(proc))
+		insertar_ultimo(&lista_interactivos, proc);
+	else
+		insertar_ultimo(&lista_fifo, proc);
+}
+
+void rr_desencolar(BCP * proc){
+	if (es_interactivo(proc))
+		eliminar_elem(&lista_interactivos, proc);
+	else
+		eliminar_elem(&lista_fifo, proc);
+}
+
+BCP * rr_primero(){
+	if (lista_interactivos.primero)
+		return lista_interactivos.primero;
+	return lista_fifo.primero;
+}
+
+/*
+ * RR. Si el proceso en ejecucion ha vencido su rodaja pierde
+ * interactividad y se activa la int SW. Se le fija una rodaja nueva para
+ * no contar el mismo vencimiento en cada tick hasta que deje la UCP.
+ */
+void rr_tick(unsigned int n, BCP *actual){
+	if (actual && rodaja_agotada(actual)) {
+		if (actual->interactividad>0)
+			actual->interactividad--;
+		actual->fin_rodaja=ticks_sistema+rr_rodaja(actual);
+		activar_int_SW();
+	}
+}
+
+/*
+ * RR. Un interactivo que despierta expulsa al actual si este no lo es.
+ */
+int rr_despertar(BCP * proc, BCP *actual){
+	return actual && es_interactivo(proc) && !es_interactivo(actual);
+}
+
+/*
+ * RR. Rodaja corta para los interactivos, que solo necesitan responder, y
+ * larga para los de lote, que asi cambian menos de contexto.
+ */
+unsigned int rr_rodaja(BCP * proc){
+	if (es_interactivo(proc))
+		return RODAJA_INTERACTIVA;
+	if (proc->interactividad<=UMBRAL_LOTE)
+		return RODAJA_LOTE;
+	return TICKS_POR_RODAJA;
+}
+
+/*
+ * MLFQ. Inserta un BCP al final de la lista de su nivel, que se marca como
+ * no vacio en el mapa de bits.
+ */
+void mlfq_encolar(BCP * proc){
+	insertar_ultimo(&lista_listos[proc->nivel], proc);
+	mapa_listos|=(1u<<proc->nivel);
+}
+
+/*
+ * MLFQ. Elimina un BCP de la lista de su nivel, que se desmarca si se
+ * queda vacio.
+ */
+void mlfq_desencolar(BCP * proc){
+	int prio=proc->nivel;
+
+	eliminar_elem(&lista_listos[prio], proc);
+	if (lista_listos[prio].primero==NULL)
+		mapa_listos&=~(1u<<prio);
+}
+
+/*
+ * MLFQ. Devuelve el primero del nivel mas urgente no vacio, que se obtiene
+ * con una unica busqueda del primer bit activo.
+ */
+BCP * mlfq_primero(){
+	if (mapa_listos==0)
+		return NULL;
+	return lista_listos[__builtin_ctz(mapa_listos)].primero;
+}
+
+/*
+ * MLFQ. Boost periodico de prioridades y envejecimiento. Si el proceso en
+ * ejecucion ha vencido su rodaja baja de nivel (con una rodaja nueva de
+ * ese nivel por si tarda en dejar la UCP) y se activa la int SW.
+ */
+void mlfq_tick(unsigned int n, BCP *actual){
+	if (ticks_hasta_boost<=n) {
+		boost_prioridades();
+		ticks_hasta_boost=TICKS_POR_BOOST;
+	}
+	else
+		ticks_hasta_boost-=n;
+	envejecer();
+
+	if (actual && rodaja_agotada(actual)) {
+		degradar(actual);
+		actual->fin_rodaja=ticks_sistema+rodaja_nivel[actual->nivel];
+		activar_int_SW();
+	}
+}
+
+/*
+ * MLFQ. Se bloqueo antes de agotar la rodaja -> sube de nivel. Expulsa al
+ * actual si queda en un nivel mas urgente.
+ */
+int mlfq_despertar(BCP * proc, BCP *actual){
+	promocionar(proc);
+	return actual && proc->nivel<actual->nivel;
+}
+
+unsigned int mlfq_rodaja(BCP * proc){
+	return rodaja_nivel[proc->nivel];
+}
+
+/*
+ * MLFQ. Tras cambiar una prioridad expulsa al actual si el primero de la
+ * cola esta ahora en un nivel mas urgente.
+ */
+int mlfq_prioridad(BCP * proc, BCP *actual){
+	BCP *primero=mlfq_primero();
+
+	return actual && primero && primero->nivel<actual->nivel;
+}
+
+/*
+ * Clases que no usan la prioridad (solo el nivel inicial del proceso si
+ * luego se cambia a MLFQ): cambiarla nunca expulsa.
+ */
+int prioridad_sin_efecto(BCP * proc, BCP *actual){
+	return 0;
+}
+
+/*
+ * CFS y STRIDE. Elimina un BCP del monticulo de listos.
+ */
+void mont_desencolar(BCP * proc){
+	eliminar_mont(&monticulo_listos, proc);
+}
+
+/*
+ * CFS y STRIDE. Devuelve el de menor clave del monticulo de listos.
+ */
+BCP * mont_primero(){
+	return primero_mont(&monticulo_listos);
+}
+
+/*
+ * CFS. Inserta un BCP en el monticulo ordenado por tiempo virtual.
+ */
+void cfs_encolar(BCP * proc){
+	insertar_mont(&monticulo_listos, proc, proc->vruntime);
+}
+
+/*
+ * CFS. Avanza el tiempo virtual minimo hasta el menor de los tiempos
+ * virtuales del proceso actual y del primero de la cola de listos.
+ */
+static void actualizar_min_vruntime(BCP *actual){
+	unsigned long long v=actual->vruntime;
+	BCP *primero=primero_mont(&monticulo_listos);
+
+	if (primero && primero->vruntime<v)
+		v=primero->vruntime;
+	if (v>min_vruntime)
+		min_vruntime=v;
+}
+
+/*
+ * CFS. Carga al proceso actual los ticks ejecutados ponderados por el peso
+ * de su nice. Si ya lleva demasiada ventaja al primero de la cola se le
+ * expulsa.
+ */
+void cfs_tick(unsigned int n, BCP *actual){
+	BCP *primero;
+
+	if (actual==NULL)
+		return;
+	actual->vruntime+=(unsigned long long)n*PESO_NICE_0*PESO_NICE_0/actual->peso;
+	actualizar_min_vruntime(actual);
+
+	primero=primero_mont(&monticulo_listos);
+	if (primero && actual->vruntime>primero->vruntime+
+			(unsigned long long)GRANULARIDAD_CFS*PESO_NICE_0)
+		activar_int_SW();
+}
+
+/*
+ * CFS. Acota el tiempo virtual del que vuelve tras estar bloqueado para
+ * que no acapare la UCP por el tiempo que ha dormido. Expulsa al actual si
+ * su tiempo virtual (con el credito por dormir) es menor en mas de
+ * GRANULARIDAD_DESPERTAR_CFS.
+ */
+int cfs_despertar(BCP * proc, BCP *actual){
+	unsigned long long credito=(unsigned long long)CREDITO_DORMIDO_CFS*PESO_NICE_0;
+
+	if (min_vruntime>credito && proc->vruntime<min_vruntime-credito)
+		proc->vruntime=min_vruntime-credito;
+	return actual && proc->vruntime+
+		(unsigned long long)GRANULARIDAD_DESPERTAR_CFS*PESO_NICE_0<actual->vruntime;
+}
+
+/*
+ * CFS. Sin rodaja: la expulsion la decide cfs_tick.
+ */
+unsigned int cfs_rodaja(BCP * proc){
+	return 0;
+}
+
+/*
+ * STRIDE. Inserta un BCP en el monticulo ordenado por pase.
+ */
+void stride_encolar(BCP * proc){
+	insertar_mont(&monticulo_listos, proc, proc->pase);
+}
+
+/*
+ * STRIDE. Avanza el pase del proceso actual por los ticks ejecutados y el
+ * pase minimo hasta el menor de los pases en juego. Al vencer la rodaja
+ * se activa la int SW.
+ */
+void stride_tick(unsigned int n, BCP *actual){
+	BCP *primero;
+	unsigned long long pase;
+
+	if (actual==NULL)
+		return;
+	actual->pase+=(unsigned long long)n*actual->zancada;
+
+	pase=actual->pase;
+	primero=primero_mont(&monticulo_listos);
+	if (primero && primero->pase<pase)
+		pase=primero->pase;
+	if (pase>pase_minimo)
+		pase_minimo=pase;
+
+	if (rodaja_agotada(actual))
+		activar_int_SW();
+}
+
+/*
+ * STRIDE. Al volver de un bloqueo no puede tener un pase atrasado.
+ * Expulsa al actual si su pase es menor.
+ */
+int stride_despertar(BCP * proc, BCP *actual){
+	if (proc->pase<pase_minimo)
+		proc->pase=pase_minimo;
+	return actual && proc->pase<actual->pase;
+}
+
+unsigned int stride_rodaja(BCP * proc){
+	return RODAJA_STRIDE;
+}
+
+/*
+ * GRUPOS. Inserta un BCP al final de la lista de su grupo. Si el grupo no
+ * tenia ningun proceso listo ni en ejecucion vuelve a competir desde el
+ * pase minimo, sin credito por el tiempo que no ha usado.
+ */
+void grupos_encolar(BCP * proc){
+	grupo *g=&tabla_grupos[proc->grupo];
+	BCP *actual=en_ejecucion();
+
+	if (g->listos.primero==NULL && g->pase<pase_minimo_grupos &&
+			(actual==NULL || actual==proc || actual->grupo!=proc->grupo))
+		g->pase=pase_minimo_grupos;
+	insertar_ultimo(&g->listos, proc);
+}
+
+/*
+ * GRUPOS. Elimina un BCP de la lista de su grupo.
+ */
+void grupos_desencolar(BCP * proc){
+	eliminar_elem(&tabla_grupos[proc->grupo].listos, proc);
+}
+
+/*
+ * GRUPOS. Devuelve el primero de la lista del grupo de menor pase que
+ * tenga procesos listos.
+ */
+BCP * grupos_primero(){
+	int i;
+	grupo *mejor=NULL;
+
+	for (i=0; i<MAX_GRUPOS; i++)
+		if (tabla_grupos[i].usado && tabla_grupos[i].listos.primero &&
+				(mejor==NULL || tabla_grupos[i].pase<mejor->pase))
+			mejor=&tabla_grupos[i];
+	if (mejor==NULL)
+		return NULL;
+	return mejor->listos.primero;
+}
+
+/*
+ * GRUPOS. Avanza el pase del grupo del proceso actual por los ticks
+ * ejecutados y el pase minimo hasta el menor de los pases en juego. Al
+ * vencer la rodaja se activa la int SW.
+ */
+void grupos_tick(unsigned int n, BCP *actual){
+	grupo *g;
+	BCP *primero;
+	unsigned long long pase;
+
+	if (actual==NULL)
+		return;
+	g=&tabla_grupos[actual->grupo];
+	g->pase+=(unsigned long long)n*g->zancada;
+
+	pase=g->pase;
+	primero=grupos_primero();
+	if (primero && tabla_grupos[primero->grupo].pase<pase)
+		pase=tabla_grupos[primero->grupo].pase;
+	if (pase>pase_minimo_grupos)
+		pase_minimo_grupos=pase;
+
+	if (rodaja_agotada(actual))
+		activar_int_SW();
+}
+
+/*
+ * GRUPOS. El que despierta expulsa al actual si es de otro grupo con menor
+ * pase (el ajuste del pase lo hace grupos_encolar).
+ */
+int grupos_despertar(BCP * proc, BCP *actual){
+	grupo *g=&tabla_grupos[proc->grupo];
+	unsigned long long pase=g->pase;
+
+	if (actual==NULL || actual->grupo==proc->grupo)
+		return 0;
+	if (g->listos.primero==NULL && pase<pase_minimo_grupos)
+		pase=pase_minimo_grupos;
+	return pase<tabla_grupos[actual->grupo].pase;
+}
+
+unsigned int grupos_rodaja(BCP * proc){
+	return RODAJA_STRIDE;
+}
+
+/*
+ * RAFAGA. Inserta un BCP en el monticulo ordenado por rafaga prevista.
+ */
+void rafaga_encolar(BCP * proc){
+	insertar_mont(&monticulo_listos, proc, proc->cpu.rafaga_prevista);
+}
+
+/*
+ * RAFAGA. Al vencer la rodaja se activa la int SW: su rafaga se cierra y,
+ * si es larga, otros con rafagas previstas mas cortas pasan por delante.
+ */
+void rafaga_tick(unsigned int n, BCP *actual){
+	if (actual && rodaja_agotada(actual))
+		activar_int_SW();
+}
+
+/*
+ * RAFAGA. El que despierta expulsa al actual si su rafaga prevista es
+ * menor que lo que se preve que le queda al actual.
+ */
+int rafaga_despertar(BCP * proc, BCP *actual){
+	unsigned long long hecho;
+
+	if (actual==NULL)
+		return 0;
+	hecho=(ticks_sistema-actual->tick_rafaga)*FIJO_RAFAGA;
+	return hecho<actual->cpu.rafaga_prevista &&
+		proc->cpu.rafaga_prevista<actual->cpu.rafaga_prevista-hecho;
+}
+
+unsigned int rafaga_rodaja(BCP * proc){
+	return TICKS_POR_RODAJA;
+}
+
+/*
+ * L. Longitud de la cola de listos de la politica en uso (incluida la de
+ * tiempo real), sin contar al proceso en ejecucion.
+ */
+static unsigned int longitud_listos(){
+	unsigned int i, n=monticulo_rt.n+monticulo_listos.n+lista_fifo.n+
+		lista_interactivos.n+lista_clase_fifo.n+lista_clase_lote.n+
+		lista_clase_ociosa.n;
+
+	for (i=0; i<NUM_PRIORIDADES; i++)
+		n+=lista_listos[i].n;
+	for (i=0; i<MAX_GRUPOS; i++)
+		n+=tabla_grupos[i].listos.n;
+	return n;
+}
+
+/*
+ * L. Muestrea n ticks de carga. Cada tick suma los procesos listos o en
+ * ejecucion y apunta la longitud de la cola en el histograma; cada TICK
+ * ticks la media de ese segundo se incorpora a las medias exponenciales.
  */
-static void espera_int(){
-	int nivel;
+static void actualizar_carga(unsigned int n){
+	unsigned int listos=longitud_listos();
+	unsigned int activos=listos;
+	unsigned long long muestra;
+	int i;
 
-	// printk("-> NO HAY LISTOS. ESPERA INT\n");
+	if (p_proc_actual && p_proc_actual->estado==LISTO)
+		activos++;
+
+	histograma_listos[listos]+=n;
+	while (n-->0) {
+		suma_carga+=activos;
+		if (++ticks_carga<TICK)
+			continue;
+		muestra=(unsigned long long)suma_carga*FIJO_CARGA/TICK;
+		for (i=0; i<3; i++)
+			media_carga[i]=(media_carga[i]*(unsigned long long)exp_carga[i]+
+				muestra*(FIJO_CARGA-exp_carga[i])+FIJO_CARGA/2)>>FRAC_CARGA;
+		suma_carga=0;
+		ticks_carga=0;
+	}
+}
 
-	/* Baja al m�nimo el nivel de interrupci�n mientras espera */
-	nivel=fijar_nivel_int(NIVEL_1);
-	halt();
-	fijar_nivel_int(nivel);
+/*
+ *
+ * Funciones de la rueda de temporizadores
+ *	colocar_temporizador quitar_temporizador armar_temporizador
+ *	cancelar_temporizador avanzar_rueda ticks_hasta_temporizador
+ *
+ */
+
+/*
+ * Mete el temporizador en el cubo que le toca segun lo que falta para que
+ * venza. Los ya vencidos van al cubo del siguiente tick y los que no caben
+ * en la rueda al ultimo cubo alcanzable, donde se recolocan al repartirlo.
+ */
+static void colocar_temporizador(temporizador *t){
+	unsigned long long vence=t->vence;
+	int nivel=0;
+
+	if (vence<=tick_rueda)
+		vence=tick_rueda+1;
+	else if (vence-tick_rueda>=(1ULL<<(BITS_RUEDA*NIVELES_RUEDA)))
+		vence=tick_rueda+(1ULL<<(BITS_RUEDA*NIVELES_RUEDA))-1;
+	while (nivel<NIVELES_RUEDA-1 &&
+			vence-tick_rueda>=(1ULL<<(BITS_RUEDA*(nivel+1))))
+		nivel++;
+
+	t->cubo=&rueda[nivel][(vence>>(BITS_RUEDA*nivel))&MASCARA_RUEDA];
+	t->anterior=NULL;
+	t->siguiente=*t->cubo;
+	if (t->siguiente)
+		t->siguiente->anterior=t;
+	*t->cubo=t;
 }
 
 /*
- * Funci�n de planificacion que implementa un algoritmo FIFO.
+ * Saca el temporizador de su cubo.
  */
-static BCP * planificador(){
-	while (lista_listos.primero==NULL)
-		espera_int();		/* No hay nada que hacer */
-	return lista_listos.primero;
+static void quitar_temporizador(temporizador *t){
+	if (t->anterior)
+		t->anterior->siguiente=t->siguiente;
+	else
+		*t->cubo=t->siguiente;
+	if (t->siguiente)
+		t->siguiente->anterior=t->anterior;
+	t->cubo=NULL;
 }
 
-/*RR. gestor de cambio de proceso del RR*/
-static void cambioProceso(lista_BCPs *lista_destino) { 
-	
-	//Guardamos el proceso actual:
-	BCP * p_proc_anterior = p_proc_actual;
-	//Elevamos el nivel de int:
-	int level=fijar_nivel_int(NIVEL_3);
-	
-	//Eliminamos el proceso de la lista de listos:
-	eliminar_primero(&lista_listos);
+/*
+ * Arma el temporizador para que venza en el tick absoluto vence (si ya
+ * estaba armado se reprograma). Se llama a nivel 3.
+ */
+static void armar_temporizador(temporizador *t, unsigned long long vence,
+		void (*vencer)(temporizador *t), void *dato){
+	if (t->cubo)
+		quitar_temporizador(t);
+	else
+		temporizadores_armados++;
+	t->vence=vence;
+	t->vencer=vencer;
+	t->dato=dato;
+	colocar_temporizador(t);
+}
 
-	//Si se paso una lista se añade a ella:
-	if (lista_destino) {
-		insertar_ultimo(lista_destino, p_proc_anterior);
+/*
+ * Desarma el temporizador si esta armado. Devuelve 1 si lo estaba. Se
+ * llama a nivel 3.
+ */
+static int cancelar_temporizador(temporizador *t){
+	if (!t->cubo)
+		return 0;
+	quitar_temporizador(t);
+	temporizadores_armados--;
+	return 1;
+}
+
+/*
+ * Reparte un cubo de un nivel superior entre los inferiores.
+ */
+static void repartir_cubo(temporizador **cubo){
+	temporizador *t;
+
+	while ((t=*cubo)!=NULL) {
+		quitar_temporizador(t);
+		colocar_temporizador(t);
 	}
+}
 
-	//Llamamos al proximo proceso:
-	p_proc_actual = planificador(); 
-	//Inicializamos la nueva rodaja:
-	p_proc_actual->rodaja = TICKS_POR_RODAJA;
-	
-	//Si el proceso ha terminado, se libera su pila:
-	contexto_t *contexto_aux;
-	if (p_proc_anterior->estado == TERMINADO) {
-		contexto_aux = NULL;
-		liberar_pila(p_proc_anterior->pila);
+/*
+ * Procesa la rueda hasta el tick ahora: en cada tick reparte los cubos de
+ * los niveles superiores que empiezan (del mas alto al mas bajo) y vence
+ * los del cubo del nivel 0. Solo toca los cubos de los ticks que pasan.
+ * Se llama a nivel 3.
+ */
+static void avanzar_rueda(unsigned long long ahora){
+	temporizador *t;
+	int nivel;
+
+	if (temporizadores_armados==0) {
+		tick_rueda=ahora;
+		return;
 	}
-	else {
-		//Si no se guarda el contexto:
-		contexto_aux=&(p_proc_anterior->contexto_regs);
+	while (tick_rueda<ahora) {
+		tick_rueda++;
+		for (nivel=NIVELES_RUEDA-1; nivel>0; nivel--)
+			if ((tick_rueda&((1ULL<<(BITS_RUEDA*nivel))-1))==0)
+				repartir_cubo(&rueda[nivel][(tick_rueda>>(BITS_RUEDA*nivel))&MASCARA_RUEDA]);
+		while ((t=rueda[0][tick_rueda&MASCARA_RUEDA])!=NULL) {
+			quitar_temporizador(t);
+			temporizadores_armados--;
+			t->vencer(t);
+		}
 	}
-	
-	printk("\x1b[32m""-> C.CONTEXTO DE %d A %d\n""\x1b[0m", p_proc_anterior->id, p_proc_actual->id);
-	//Realizamos el cambio de contexto:
-	cambio_contexto(contexto_aux, &(p_proc_actual->contexto_regs));
-
-	//Volvemos al nivel original:
-	fijar_nivel_int(level); 
 }
 
 /*
- *
- * Funcion auxiliar que termina proceso actual liberando sus recursos.
- * Usada por llamada terminar_proceso y por rutinas que tratan excepciones
- *
+ * Devuelve cuantos ticks faltan, como mucho max, para el siguiente tick
+ * en el que hay que procesar la rueda: vence un temporizador o se reparte
+ * un cubo de un nivel superior.
  */
-static void liberar_proceso(){
-	BCP * p_proc_anterior;
+static unsigned int ticks_hasta_temporizador(unsigned int max){
+	unsigned int i;
+	unsigned long long t;
+
+	if (temporizadores_armados==0)
+		return max;
+	for (i=1; i<=max && i<=TAM_RUEDA; i++) {
+		t=tick_rueda+i;
+		if ((t&MASCARA_RUEDA)==0 || rueda[0][t&MASCARA_RUEDA])
+			return i;
+	}
+	return max;
+}
 
-	liberar_imagen(p_proc_actual->info_mem); /* liberar mapa */
+/*
+ * Pasa milisegundos a ticks redondeando hacia arriba.
+ */
+static unsigned long long ms_a_ticks(unsigned int ms){
+	return ((unsigned long long)ms+MS_POR_TICK-1)/MS_POR_TICK;
+}
 
-	p_proc_actual->estado=TERMINADO;
-	
-	//Se cambia el proceso sin guardar el contexto:
-	printk("\x1b[33m""#>\t""\x1b[0m""Liberado: %d\n", p_proc_actual->id);
-	cambioProceso(NULL);
-	
-    return; /* no deber�a llegar aqui */
+/*
+ * I. Accion del temporizador de dormir: pasa el proceso a listos.
+ */
+static void despertar_dormido(temporizador *t){
+	num_dormidos--;
+	insertar_listo((BCP *)t->dato);
 }
 
 /*
- *
- * Funciones relacionadas con el tratamiento de interrupciones
- *	excepciones: exc_arit exc_mem
- *	interrupciones de reloj: int_reloj
- *	interrupciones del terminal: int_terminal
- *	llamadas al sistemas: llam_sis
- *	interrupciones SW: int_sw
- *
+ * Accion del temporizador de la alarma de un proceso: apunta el
+ * vencimiento, la rearma si es periodica (contando desde el vencimiento,
+ * para que no derive) y despierta al proceso si la esta esperando.
  */
+static void vencer_alarma(temporizador *t){
+	BCP *proc=(BCP *)t->dato;
+
+	proc->alarmas_pendientes++;
+	if (proc->periodo_alarma>0)
+		armar_temporizador(t, t->vence+proc->periodo_alarma, vencer_alarma, proc);
+	if (proc->esperando_alarma) {
+		proc->esperando_alarma=0;
+		insertar_listo(proc);
+	}
+}
 
 /*
- * Tratamiento de excepciones aritmeticas
+ * Avanza n ticks el reloj del sistema: repone presupuestos de tiempo real,
+ * despierta a los dormidos que vencen y pasa los ticks a la clase en uso.
+ * En reposo con tick dinamico n puede ser mayor que 1.
  */
-static void exc_arit(){
+static void avanzar_ticks(unsigned int n){
 
-	if (!viene_de_modo_usuario())
-		panico("excepcion aritmetica cuando estaba dentro del kernel");
+	//L. Los ticks transcurridos se muestrean con el estado que han tenido:
+	actualizar_carga(n);
 
+	ticks_sistema+=n;
 
-	printk("\x1b[32m""-> EXCEPCION ARITMETICA EN PROC %d\n""\x1b[0m", p_proc_actual->id);
-	liberar_proceso();
+	//EDF. Reponemos los presupuestos de los periodos que empiezan:
+	if (lista_rt_agotados.primero!=NULL) {
+		int nivel=fijar_nivel_int(NIVEL_3);
+		reponer_presupuestos();
+		fijar_nivel_int(nivel);
+	}
 
-        return; /* no deber�a llegar aqui */
+	//Vencen los temporizadores (p.ej. despiertan los dormidos) de los
+	//ticks que pasan:
+	int nivel=fijar_nivel_int(NIVEL_3);
+	actualizar_pagina();
+	avanzar_rueda(ticks_sistema);
+
+	//La clase en uso contabiliza los ticks al proceso en ejecucion; los de
+	//las clases LOTE y OCIOSA solo tienen que respetar su rodaja:
+	BCP *actual=en_ejecucion();
+	vigilar_agente();
+	clase->tick(n, actual_normal());
+	if (actual && !actual->tiempo_real &&
+			(actual->clase_proc==CLASE_LOTE || actual->clase_proc==CLASE_OCIOSA) &&
+			rodaja_agotada(actual))
+		activar_int_SW();
+	fijar_nivel_int(nivel);
 }
 
 /*
- * Tratamiento de excepciones en el acceso a memoria
+ *
+ * Funciones del tick dinamico
+ *	proximo_evento programar_reloj ticks_transcurridos
+ *	entrar_reposo salir_reposo
+ *
  */
-static void exc_mem(){
-
-	if (!viene_de_modo_usuario())
-		panico("excepcion de memoria cuando estaba dentro del kernel");
 
+/*
+ * Devuelve cuantos ticks faltan para el siguiente evento temporizado
+ * (vence un temporizador o empieza un periodo de tiempo real), como
+ * mucho TICK.
+ */
+static unsigned int proximo_evento(){
+	unsigned int prox=ticks_hasta_temporizador(TICK);
+	BCP *proc;
+
+	for (proc=lista_rt_agotados.primero; proc; proc=proc->siguiente) {
+		if (proc->rt_activacion<=ticks_sistema)
+			return 1;
+		if (proc->rt_activacion-ticks_sistema<prox)
+			prox=proc->rt_activacion-ticks_sistema;
+	}
+	return (prox>0)?prox:1;
+}
 
-	printk("\x1b[32m""-> EXCEPCION DE MEMORIA EN PROC %d\n""\x1b[0m", p_proc_actual->id);
-	liberar_proceso();
+/*
+ * Programa el reloj con la menor frecuencia entera cuyo periodo no supera
+ * el tiempo que queda hasta el siguiente evento.
+ */
+static void programar_reloj(){
+	unsigned int prox=proximo_evento();
+	unsigned int frec=(TICK+prox-1)/prox;
 
-        return; /* no deber�a llegar aqui */
+	if (frec!=frecuencia_reloj) {
+		iniciar_cont_reloj(frec);
+		frecuencia_reloj=frec;
+	}
 }
 
 /*
- * Tratamiento de interrupciones de terminal
+ * Devuelve los ticks completos transcurridos desde el ultimo contabilizado
+ * segun el reloj CMOS (en ms) y los marca como contabilizados.
  */
-static void int_terminal(){
-	char car;
-
-	car = leer_puerto(DIR_TERMINAL);
-	printk("\x1b[32m""-> TRATANDO INT. DE TERMINAL %c\n""\x1b[0m", car);
+static unsigned int ticks_transcurridos(){
+	unsigned long long ahora=leer_reloj_CMOS();
+	unsigned int n;
+
+	if (ahora<ms_ultimo_tick)
+		return 0;
+	n=(ahora-ms_ultimo_tick)/MS_POR_TICK;
+	ms_ultimo_tick+=(unsigned long long)n*MS_POR_TICK;
+	return n;
+}
 
-        return;
+/*
+ * Pasa a tick dinamico al quedarse el sistema sin procesos listos.
+ */
+static void entrar_reposo(){
+	ms_ultimo_tick=leer_reloj_CMOS();
+	tick_dinamico_activo=1;
+	programar_reloj();
 }
 
-/*RR. Función que actualiza la rodaja por cada int de reloj*/
-static void actualizarRodaja(){
-	//Si el proceso esta listo se decrementa la rodaja:
-	if (p_proc_actual->estado == LISTO) {
-		p_proc_actual->rodaja--;
-		printk("\x1b[33m""#>\t""\x1b[0m""Actualizado: rodajas->%d id->%d\n", p_proc_actual->rodaja, p_proc_actual->id);
-		//Si se llega a 0 se activa la interrupcion de software:
-		if (p_proc_actual->rodaja==0) activar_int_SW();
+/*
+ * Vuelve al tick periodico procesando los ticks pendientes.
+ */
+static void salir_reposo(){
+	unsigned int n=ticks_transcurridos();
+
+	tick_dinamico_activo=0;
+	if (n>0)
+		avanzar_ticks(n);
+	if (frecuencia_reloj!=TICK) {
+		iniciar_cont_reloj(TICK);
+		frecuencia_reloj=TICK;
 	}
 }
 
@@ -250,35 +1884,32 @@ static void actualizarRodaja(){
  * Tratamiento de interrupciones de reloj
  */
 static void int_reloj(){
-	
-	//Actualizamos la rodaja actual:
-	actualizarRodaja();
-
-	//Apuntamos al primer elemento de la lista de bloqueados:
-	BCP *procARevisar = lista_dormidos.primero;
-
-	//Recorremos la lista de procesos bloqueados:
-	while(procARevisar!=NULL){
-
-		//Decrementamos un tick el proceso a revisar:
-		procARevisar->ticksDormido--;
-		//Apuntamos al siguiente proceso:
-		BCP *siguiente=procARevisar->siguiente;
-
-		//Si el los ticks estan a cero lo pasamos de la lista de bloqueados a la de listos:
-		if(procARevisar->ticksDormido==0){
-			//Elevamos el nivel de int para inhibir otra int_reloj:
-			int nivel=fijar_nivel_int(NIVEL_3);
-			//Eliminamos del la lista de dormidos:
-			eliminar_elem(&lista_dormidos,procARevisar);
-			//Lo insertamos al final de la lista de listos:
-			insertar_ultimo(&lista_listos,procARevisar);
-			//Volvemos al nivel original 
-			fijar_nivel_int(nivel);
-		}
-		//Cambiamos al siguiente proceso:
-		procARevisar=siguiente;
+
+	//Tick dinamico. En reposo se procesan de golpe los ticks transcurridos
+	//y se reprograma el reloj para el siguiente evento:
+	if (tick_dinamico_activo) {
+		unsigned int n=ticks_transcurridos();
+		if (n>0)
+			avanzar_ticks(n);
+		programar_reloj();
+		return;
 	}
+
+	//Primero avanza el tiempo, de modo que las rodajas vencen en el tick
+	//fijado al elegir el proceso:
+	avanzar_ticks(1);
+
+	//C. Se carga el tick al proceso en ejecucion segun el modo interrumpido:
+	if (p_proc_actual->estado==LISTO) {
+		if (viene_de_modo_usuario())
+			p_proc_actual->cpu.ticks_usuario++;
+		else
+			p_proc_actual->cpu.ticks_nucleo++;
+	}
+
+	//EDF. La clase en uso ya ha contabilizado el tick en avanzar_ticks:
+	if (p_proc_actual->tiempo_real)
+		actualizarPresupuesto();
 }
 
 /*
@@ -288,10 +1919,12 @@ static void tratar_llamsis(){
 	int nserv, res;
 
 	nserv=leer_registro(0);
+	trazar(TRZ_LLAMSIS, p_proc_actual->id, nserv);
 	if (nserv<NSERVICIOS)
 		res=(tabla_servicios[nserv].fservicio)();
 	else
 		res=-1;		/* servicio no existente */
+	trazar(TRZ_FIN_LLAMSIS, p_proc_actual->id, res);
 	escribir_registro(0,res);
 	return;
 }
@@ -301,10 +1934,27 @@ static void tratar_llamsis(){
  */
 static void int_sw(){
 
-	printk("\x1b[32m""-> TRATANDO INT. SW\n""\x1b[0m");
+	int nivel=fijar_nivel_int(NIVEL_3);
+	//Si no hay proceso en ejecucion (p.ej. ya se bloqueo) no hay a quien expulsar:
+	if (p_proc_actual->estado != LISTO) {
+		fijar_nivel_int(nivel);
+		return;
+	}
+
+	//EDF. Si ha agotado su presupuesto espera a su siguiente periodo:
+	if (p_proc_actual->tiempo_real && p_proc_actual->rt_presupuesto==0) {
+		p_proc_actual->estado=BLOQUEADO;
+		trazar(TRZ_BLOQUEO, p_proc_actual->id, BLQ_PRESUPUESTO);
+		cambioProceso(&lista_rt_agotados);
+		fijar_nivel_int(nivel);
+		return;
+	}
 
-	//Cambiamos el proceso:
-	cambioProceso(&lista_listos);
+	//Devolvemos el proceso a la cola de listos y lo cambiamos:
+	publicar_evento(EVT_EXPULSION, p_proc_actual);
+	insertar_listo(p_proc_actual);
+	cambioProceso(NULL);
+	fijar_nivel_int(nivel);
 
 	return;
 }
@@ -340,7 +1990,26 @@ static int crear_tarea(char *prog){
 		p_proc->id=proc;
 		p_proc->estado=LISTO;
 
-		p_proc->rodaja=TICKS_POR_RODAJA;
+		p_proc->interactividad=INTERACTIVIDAD_INICIAL;
+		p_proc->clase_proc=CLASE_NORMAL;
+		p_proc->aviso=NULL;
+		p_proc->alarmas_pendientes=0;
+		p_proc->esperando_alarma=0;
+		//Hereda el grupo del proceso que lo crea (init va al grupo 0):
+		entrar_grupo(p_proc, p_proc_actual ? p_proc_actual->grupo : 0);
+		p_proc->prioridad=PRIORIDAD_DEFECTO;
+		p_proc->nivel=PRIORIDAD_DEFECTO;
+		p_proc->nice=0;
+		p_proc->peso=PESO_NICE_0;
+		p_proc->vruntime=min_vruntime;
+		p_proc->tickets=TICKETS_DEFECTO;
+		p_proc->zancada=STRIDE1/TICKETS_DEFECTO;
+		p_proc->pase=pase_minimo;
+		p_proc->prestado_a=-1;
+		p_proc->tiempo_real=0;
+		memset(&p_proc->cpu, 0, sizeof(p_proc->cpu));
+		p_proc->cpu.rafaga_prevista=RAFAGA_INICIAL*FIJO_RAFAGA;
+		p_proc->tick_listo=ticks_sistema;
 
 		/* Bucle para inicializar los descriptores */
 		for(int i=0; i<NUM_MUT_PROC; i++){
@@ -349,7 +2018,8 @@ static int crear_tarea(char *prog){
 
 		/* lo inserta al final de cola de listos */
 		int level = fijar_nivel_int(NIVEL_3);
-		insertar_ultimo(&lista_listos, p_proc);
+		insertar_listo(p_proc);
+		publicar_evento(EVT_NUEVO, p_proc);
 		fijar_nivel_int(level);
 		error= 0;
 	}
@@ -400,6 +2070,53 @@ static int buscarMutexLibre(){
 	return -1;
 }
 
+/*I. Accion del temporizador de una espera con plazo en un mutex: saca al
+  proceso de la lista en la que espera y lo despierta con el plazo vencido*/
+static void vencer_espera_mutex(temporizador *t){
+	BCP *proc=(BCP *)t->dato;
+
+	if (proc->mutex_espera==-1)
+		eliminar_elem(&lista_bloqueados, proc);
+	else
+		eliminar_elem(&tabla_mutexs[proc->mutex_espera].procesos_bloqueados_lock, proc);
+	proc->plazo_vencido=1;
+	insertar_listo(proc);
+}
+
+/*I. Funcion que bloquea al proceso actual en la lista del mutex des (-1 la
+  de espera de mutex libre). Con plazo, si vence antes de que le despierten
+  sale de la lista y devuelve -1 (sin bloquearse si ya ha vencido). Se
+  llama a nivel 3 */
+static int esperar_mutex(int des, int con_plazo, unsigned long long vence){
+	BCP *proc=p_proc_actual;
+
+	if (con_plazo && vence<=ticks_sistema)
+		return -1;
+
+	//Cambiar estado a bloqueado:
+	proc->estado=BLOQUEADO;
+	if (con_plazo) {
+		proc->mutex_espera=des;
+		proc->plazo_vencido=0;
+		armar_temporizador(&proc->despertador, vence, vencer_espera_mutex, proc);
+	}
+
+	if (des==-1) {
+		trazar(TRZ_BLOQUEO, proc->id, BLQ_MUTEX_LIBRE);
+		cambioProceso(&lista_bloqueados);
+	}
+	else {
+		trazar(TRZ_BLOQUEO, proc->id, BLQ_LOCK);
+		cambioProceso(&(tabla_mutexs[des].procesos_bloqueados_lock));
+	}
+
+	if (proc->plazo_vencido) {
+		proc->plazo_vencido=0;
+		return -1;
+	}
+	return 0;
+}
+
 static int cerrarMutex(unsigned int des, unsigned int posDes){
 	//Una vez encontrado, se libera:
 	p_proc_actual->descriptores_mutex[posDes]=-1;
@@ -407,19 +2124,22 @@ static int cerrarMutex(unsigned int des, unsigned int posDes){
 	if(tabla_mutexs[des].id_proc_propietario==p_proc_actual->id){
 		tabla_mutexs[des].estado=0;
 		printk("\x1b[33m""#>\t""\x1b[0m""Unlock: des->%d, proc_id->%d (B:%d)\n",des,p_proc_actual->id,tabla_mutexs[des].estado);
+		int nivel=fijar_nivel_int(NIVEL_3);
+		retirar_prestamos_mutex(des);
+		fijar_nivel_int(nivel);
 
 		//Si hay procesos bloqueados se desbloquean todos:
 		while(tabla_mutexs[des].procesos_bloqueados_lock.primero!=NULL) {
 			//Guardamos y elevamos el nivel de interrupcion:
 			int nivel_int = fijar_nivel_int(NIVEL_3);
 
-			//Ponemos a listo el proceso que esta esperando:
+			//Lo pasamos de la lista de bloqueados a la de listos (insertar_listo
+			//lo pone en LISTO al ver que despierta):
 			BCP* proc_aux = tabla_mutexs[des].procesos_bloqueados_lock.primero;
-			proc_aux->estado = LISTO;
-
-			//Lo pasamos de la lista de bloqueados a la de listos:
 			eliminar_primero(&(tabla_mutexs[des].procesos_bloqueados_lock)); 
-			insertar_ultimo(&lista_listos,proc_aux);
+			//Si esperaba con plazo se desarma su temporizador:
+			cancelar_temporizador(&proc_aux->despertador);
+			insertar_listo(proc_aux);
 
 			//Volvemos al nivel de interrupcion:
 			fijar_nivel_int(nivel_int);
@@ -440,13 +2160,13 @@ static int cerrarMutex(unsigned int des, unsigned int posDes){
 			//Guardamos y elevamos el nivel de interrupcion:
 			int nivel_int = fijar_nivel_int(NIVEL_3);
 
-			//Ponemos a listo el proceso que esta esperando:
+			//Lo pasamos de la lista de bloqueados a la de listos (insertar_listo
+			//lo pone en LISTO al ver que despierta):
 			BCP* proc_aux = lista_bloqueados.primero;
-			proc_aux->estado = LISTO;
-
-			//Lo pasamos de la lista de bloqueados a la de listos:
 			eliminar_primero(&lista_bloqueados); 
-			insertar_ultimo(&lista_listos,proc_aux);
+			//Si esperaba con plazo se desarma su temporizador:
+			cancelar_temporizador(&proc_aux->despertador);
+			insertar_listo(proc_aux);
 
 			//Volvemos al nivel de interrupcion:
 			fijar_nivel_int(nivel_int);
@@ -519,50 +2239,157 @@ int sis_obtener_id_pr(){
 	return p_proc_actual->id;
 }
 
+/*
+ * I. Duerme el proceso actual hasta el tick absoluto vence (si ya ha
+ * pasado despierta en el siguiente tick).
+ */
+static void dormir_hasta_tick(unsigned long long vence){
+
+	//Elevar nivel interrupcion y guardar actual:
+	int nivel=fijar_nivel_int(NIVEL_3);
+	//Cambiar estado a bloqueado:
+	p_proc_actual->estado=BLOQUEADO;
+	//Armamos su despertador para el tick pedido:
+	armar_temporizador(&p_proc_actual->despertador, vence,
+		despertar_dormido, p_proc_actual);
+	num_dormidos++;
+
+	//No queda en ninguna lista: lo despierta su temporizador:
+	trazar(TRZ_BLOQUEO, p_proc_actual->id, BLQ_DORMIR);
+	sumar_interactividad(p_proc_actual);
+	cambioProceso(NULL);
+
+	//Volvemos al nivel de int anterior:
+	fijar_nivel_int(nivel);
+}
+
 /*I. Funcion que duerme el proceso */
 int sis_dormir(){
 
 	//Leer de los registros los segundos:
 	unsigned int segundos=(unsigned int)leer_registro(1); 
 
-	//Elevar nivel interrupcion y guardar actual:
+	dormir_hasta_tick(ticks_sistema+(unsigned long long)segundos*TICK);
+	return 0;
+}
+
+/*I. Funcion que duerme el proceso unos milisegundos (redondeados al tick
+  siguiente) */
+int sis_dormir_ms(){
+	unsigned int ms=(unsigned int)leer_registro(1);
+
+	dormir_hasta_tick(ticks_sistema+ms_a_ticks(ms));
+	return 0;
+}
+
+/*I. Funcion que duerme el proceso hasta un tick absoluto. Si ya ha pasado
+  no se bloquea, de modo que un bucle periodico que se retrasa no acumula
+  el retraso */
+/**
+ * ERRORES:
+ * 	-1: El tick ya ha pasado.
+ */
+int sis_dormir_hasta(){
+	unsigned int tick=(unsigned int)leer_registro(1);
+
+	if (tick<=ticks_sistema) {
+		printk("\x1b[31m""[SIS_DORMIR_HASTA] - El tick %u ya ha pasado (actual %llu)\n""\x1b[0m",
+			tick, ticks_sistema);
+		return -1;
+	}
+	dormir_hasta_tick(tick);
+	return 0;
+}
+
+/*I. Funcion que devuelve los ticks desde el arranque (reloj monotono del
+  nucleo, TICK por segundo) */
+int sis_obtener_ticks(){
+	return (int)ticks_sistema;
+}
+
+/*I. Funcion que arma la alarma del proceso para dentro de ms milisegundos
+  (redondeados al tick siguiente); si es periodica vuelve a vencer cada ms.
+  Con ms 0 se desarma. Sustituye a la alarma anterior y descarta sus
+  vencimientos sin recoger */
+int sis_alarma(){
+	unsigned int ms=(unsigned int)leer_registro(1);
+	int periodica=(int)leer_registro(2);
+	unsigned long long ticks=ms_a_ticks(ms);
+
 	int nivel=fijar_nivel_int(NIVEL_3);
-	//Cambiar estado a bloqueado:
-	p_proc_actual->estado=BLOQUEADO;
-	//Cambiar los ticksDormidos a los introducidos:
-	p_proc_actual->ticksDormido=segundos*TICK;
-	//Guardamos el proceso:
-	BCP* p_proc_dormido = p_proc_actual; 
-	
-	//Eliminamos de la lista de listos:
-	eliminar_primero(&lista_listos);
-	//Lo insertamos en la lista de dormidos:
-	insertar_ultimo(&lista_dormidos, p_proc_dormido);
+	p_proc_actual->alarmas_pendientes=0;
+	if (ms==0)
+		cancelar_temporizador(&p_proc_actual->alarma);
+	else {
+		p_proc_actual->periodo_alarma=periodica?(unsigned int)ticks:0;
+		armar_temporizador(&p_proc_actual->alarma, ticks_sistema+ticks,
+			vencer_alarma, p_proc_actual);
+	}
+	fijar_nivel_int(nivel);
+	return 0;
+}
 
-	//Llamamos al planificador para el nuevo proceso actual:
-	p_proc_actual=planificador();
-	
-	//Hacemos un cambio de contexto, guardando el contexto del proceso dormido:
-	printk("\x1b[32m""-> C.CONTEXTO POR DORMIR: de %d a %d\n""\x1b[0m", p_proc_dormido->id, p_proc_actual->id);
-	cambio_contexto(&(p_proc_dormido->contexto_regs), &(p_proc_actual->contexto_regs));
+/*I. Funcion que espera a que venza la alarma del proceso (no se bloquea si
+  ya ha vencido) y devuelve cuantas veces ha vencido desde la ultima
+  llamada */
+/**
+ * ERRORES:
+ * 	-1: No tiene ninguna alarma armada ni vencimientos pendientes.
+ */
+int sis_esperar_alarma(){
+	unsigned int vencidas;
 
-	//Volvemos al nivel de int anterior:
+	int nivel=fijar_nivel_int(NIVEL_3);
+	if (p_proc_actual->alarmas_pendientes==0) {
+		if (!p_proc_actual->alarma.cubo) {
+			fijar_nivel_int(nivel);
+			printk("\x1b[31m""[SIS_ESPERAR_ALARMA] - El proceso %d no tiene alarma\n""\x1b[0m",p_proc_actual->id);
+			return -1;
+		}
+		//No queda en ninguna lista: lo despierta su alarma:
+		p_proc_actual->estado=BLOQUEADO;
+		p_proc_actual->esperando_alarma=1;
+		trazar(TRZ_BLOQUEO, p_proc_actual->id, BLQ_ALARMA);
+		sumar_interactividad(p_proc_actual);
+		cambioProceso(NULL);
+	}
+	vencidas=p_proc_actual->alarmas_pendientes;
+	p_proc_actual->alarmas_pendientes=0;
 	fijar_nivel_int(nivel);
+	return (int)vencidas;
+}
+
+/*I. Funcion que deja en la direccion indicada la de la pagina compartida
+  con el nucleo. Los procesos comparten el espacio de direcciones del
+  nucleo, asi que la biblioteca la lee directamente (y solo la lee) */
+/**
+ * ERRORES:
+ * 	-1: Direccion de destino nula.
+ */
+int sis_obtener_pagina(){
+	pagina_nucleo **dir=(pagina_nucleo **)leer_registro(1);
 
+	if (dir==NULL) {
+		printk("\x1b[31m""[SIS_OBTENER_PAGINA] - Direccion de destino nula\n""\x1b[0m");
+		return -1;
+	}
+	*dir=&pagina_compartida;
 	return 0;
 }
 
-/*I. Funcion que crea un mutex */
+/*I. Funcion que crea un mutex, esperando si no hay ninguno libre (con
+  plazo, como mucho hasta el tick vence). Comun a crear_mutex y
+  crear_mutex_timeout */
 /**
  * ERRORES:
  * -1: El nombre excede del limite de longitud.
  * -2: No hay descriptor libre en el proceso.
  * -3: Ya existe el nombre.
+ * -4: (PLAZO_VENCIDO) Vence el plazo sin que quede un mutex libre.
 */
-int sis_crear_mutex(){
+static int nuevo_mutex(char *nombre, int tipo, int con_plazo, unsigned long long vence){
 	
 	//1.Comprobamos que el tamaño del nombre es menor al maximo;
-	char* nombre=(char *)leer_registro(1);
 	int charSize=strlen(nombre);
 	if(charSize>=MAX_NOM_MUT){
 		printk("\x1b[31m""[SIS_CREAR_MUTEX] - Nombre demasiado largo (%d)\n""\x1b[0m",charSize);
@@ -588,35 +2415,28 @@ int sis_crear_mutex(){
 		printk("\x1b[31m""[SIS_CREAR_MUTEX] - No hay mutex libre, bloqueando el proceso %d\n""\x1b[0m",p_proc_actual->id);
 		//Elevar nivel interrupcion y guardar actual:
 		int nivel=fijar_nivel_int(NIVEL_3);
-		//Cambiar estado a bloqueado:
-		p_proc_actual->estado=BLOQUEADO;
-		//Guardamos el proceso:
-		BCP* p_proc_bloqueado = p_proc_actual; 
-						
-		//Eliminamos de la lista de listos:
-		eliminar_primero(&lista_listos);
-		//Lo insertamos en la lista de bloqueado:
-		insertar_ultimo(&lista_bloqueados, p_proc_bloqueado);
-
-		//Llamamos al planificador para el nuevo proceso actual:
-		p_proc_actual=planificador();
-						
-		//Hacemos un cambio de contexto, guardando el contexto del proceso dormido:
-		printk("\x1b[32m""-> C.CONTEXTO POR MUTEX NO LIBRE: de %d a %d\n""\x1b[0m",p_proc_bloqueado->id,p_proc_actual->id);
-		cambio_contexto(&(p_proc_bloqueado->contexto_regs), &(p_proc_actual->contexto_regs));
+
+		//Lo insertamos en la lista de bloqueados y cambiamos de proceso
+		//(con plazo, hasta que venza):
+		int vencido=esperar_mutex(-1, con_plazo, vence);
 
 		//Volvemos al nivel de int anterior:
 		fijar_nivel_int(nivel);
+		if (vencido<0) {
+			printk("\x1b[31m""[SIS_CREAR_MUTEX] - Vence el plazo esperando un mutex libre en el proceso %d\n""\x1b[0m",p_proc_actual->id);
+			return PLAZO_VENCIDO;
+		}
 		mutexLibre=buscarMutexLibre();
 	}
 
 	//Inicializamos todos los aspectos del mutex:
 	MUTEX m;
 	strcpy(m.nombre,nombre);
-	m.tipo=(int)leer_registro(2);
+	m.tipo=tipo;
 	m.creado=1;/*Creado*/
 	m.procesos_bloqueados_lock.primero=NULL;
 	m.procesos_bloqueados_lock.ultimo=NULL;
+	m.procesos_bloqueados_lock.n=0;
 	m.estado=0;/*No bloqueado*/
 	m.abierto=1;/*Abierto*/
 	m.id_proc_propietario=-1;
@@ -631,6 +2451,22 @@ int sis_crear_mutex(){
 	printk("\x1b[33m""#>\t""\x1b[0m""Creado %s: des->%d, proc_id->%d (A:%d)(N:%d)\n",tabla_mutexs[mutexLibre].nombre,mutexLibre,p_proc_actual->id,tabla_mutexs[mutexLibre].abierto,n_mutexs);
 	return mutexLibre;
 }
+
+/*I. Funcion que crea un mutex, esperando lo que haga falta a que haya uno
+  libre */
+int sis_crear_mutex(){
+	return nuevo_mutex((char *)leer_registro(1), (int)leer_registro(2), 0, 0);
+}
+
+/*I. Funcion que crea un mutex esperando como mucho unos milisegundos a que
+  haya uno libre (con 0 no espera). Errores como crear_mutex */
+int sis_crear_mutex_timeout(){
+	char *nombre=(char *)leer_registro(1);
+	int tipo=(int)leer_registro(2);
+	unsigned int ms=(unsigned int)leer_registro(3);
+
+	return nuevo_mutex(nombre, tipo, 1, ticks_sistema+ms_a_ticks(ms));
+}
 /*I. Funcion que abre un mutex */
 /**
  * ERRORES:
@@ -666,17 +2502,18 @@ int sis_abrir_mutex(){
 	printk("\x1b[33m""#>\t""\x1b[0m""Abierto %s: des->%d, proc_id->%d (A:%d)\n",tabla_mutexs[des].nombre,des,p_proc_actual->id,tabla_mutexs[des].abierto);
 	return des;
 }
-/*I. Funcion que bloquea el proceso */
+/*I. Funcion que bloquea el mutex des, esperando si hace falta (con plazo,
+  como mucho hasta el tick vence). Comun a lock y lock_timeout */
 /**
  * ERRORES:
  * -1: El descriptor se sale del rango posible.
  * -2: El mutex no esta abierto.
  * -3: El mutex no recursivo ya fue bloqueado por el mismo proceso.
+ * -4: (PLAZO_VENCIDO) Vence el plazo antes de conseguir el mutex.
 */
-int sis_lock(){
+static int lock_mutex(unsigned int des, int con_plazo, unsigned long long vence){
 
 	//1.Comprobamos que el descritor esta dentro del rango:
-	unsigned int des=(unsigned int)leer_registro(1);
 	if(des>=NUM_MUT){
 		printk("\x1b[31m""[SIS_LOCK] - El descriptor no existe dentro del rango 0-%d\n""\x1b[0m",NUM_MUT);
 		return -1;
@@ -702,28 +2539,24 @@ int sis_lock(){
 				}
 				//Si no es el mismo proceso:
 				else{
-					printk("\x1b[33m""#>\t""\x1b[0m""Block %s: des->%d, proc_id->%d (B:%d)\n",tabla_mutexs[des].nombre,des,p_proc_actual->id,tabla_mutexs[des].estado);
 					//Elevar nivel interrupcion y guardar actual:
 					int nivel=fijar_nivel_int(NIVEL_3);
-					//Cambiar estado a bloqueado:
-					p_proc_actual->estado=BLOQUEADO;
-							
-					//Eliminamos de la lista de listos:
-					eliminar_primero(&lista_listos);
-					//Lo insertamos en la lista de bloqueado:
-					insertar_ultimo(&(tabla_mutexs[des].procesos_bloqueados_lock), p_proc_actual);
-					
-					//Guardamos el proceso:
-					BCP* p_proc_bloqueado = p_proc_actual; 
-					//Llamamos al planificador para el nuevo proceso actual:
-					p_proc_actual=planificador();
-									
-					//Hacemos un cambio de contexto, guardando el contexto del proceso dormido:
-					printk("\x1b[32m""-> C.CONTEXTO POR BLOQUEO: de %d a %d\n""\x1b[0m",p_proc_bloqueado->id,p_proc_actual->id);
-					cambio_contexto(&(p_proc_bloqueado->contexto_regs),&(p_proc_actual->contexto_regs));
+
+					//STRIDE. Mientras espera presta sus tickets al propietario:
+					prestar_tickets(p_proc_actual, tabla_mutexs[des].id_proc_propietario);
+
+					//Lo insertamos en la lista de bloqueados del mutex y cambiamos de proceso
+					//(con plazo, hasta que venza):
+					sumar_interactividad(p_proc_actual);
+					int vencido=esperar_mutex(des, con_plazo, vence);
+					devolver_tickets(p_proc_actual);
 		
 					//Volvemos al nivel de int anterior:
 					fijar_nivel_int(nivel);
+					if (vencido<0) {
+						printk("\x1b[31m""[SIS_LOCK] - Vence el plazo esperando el mutex en el proceso %d\n""\x1b[0m",p_proc_actual->id);
+						return PLAZO_VENCIDO;
+					}
 					
 				}
 			}
@@ -738,28 +2571,24 @@ int sis_lock(){
 				}
 				//Si el mutex no fue bloqueado por este proceso:
 				else{
-					printk("\x1b[33m""#>\t""\x1b[0m""Block %s: des->%d, proc_id->%d (B:%d)\n",tabla_mutexs[des].nombre,des,p_proc_actual->id,tabla_mutexs[des].estado);
 					//Elevar nivel interrupcion y guardar actual:
 					int nivel=fijar_nivel_int(NIVEL_3);
-					//Cambiar estado a bloqueado:
-					p_proc_actual->estado=BLOQUEADO;
-					//Guardamos el proceso:
-					BCP* p_proc_bloqueado = p_proc_actual; 
-									
-					//Eliminamos de la lista de listos:
-					eliminar_primero(&lista_listos);
-					//Lo insertamos en la lista de bloqueado:
-					insertar_ultimo(&(tabla_mutexs[des].procesos_bloqueados_lock), p_proc_bloqueado);
-
-					//Llamamos al planificador para el nuevo proceso actual:
-					p_proc_actual=planificador();
-									
-					//Hacemos un cambio de contexto, guardando el contexto del proceso dormido:
-					printk("\x1b[32m""-> C.CONTEXTO POR BLOQUEO: de %d a %d\n""\x1b[0m",p_proc_bloqueado->id,p_proc_actual->id);
-					cambio_contexto(&(p_proc_bloqueado->contexto_regs), &(p_proc_actual->contexto_regs));
+
+					//STRIDE. Mientras espera presta sus tickets al propietario:
+					prestar_tickets(p_proc_actual, tabla_mutexs[des].id_proc_propietario);
+
+					//Lo insertamos en la lista de bloqueados del mutex y cambiamos de proceso
+					//(con plazo, hasta que venza):
+					sumar_interactividad(p_proc_actual);
+					int vencido=esperar_mutex(des, con_plazo, vence);
+					devolver_tickets(p_proc_actual);
 
 					//Volvemos al nivel de int anterior:
 					fijar_nivel_int(nivel);
+					if (vencido<0) {
+						printk("\x1b[31m""[SIS_LOCK] - Vence el plazo esperando el mutex en el proceso %d\n""\x1b[0m",p_proc_actual->id);
+						return PLAZO_VENCIDO;
+					}
 				}
 			}
 		}
@@ -770,13 +2599,30 @@ int sis_lock(){
 		} 
 	}
 
-	//Se asigna el propietario a este proceso:
+	//Se asigna el propietario a este proceso y los que esperan le prestan sus tickets:
+	int nivel=fijar_nivel_int(NIVEL_3);
 	tabla_mutexs[des].id_proc_propietario=p_proc_actual->id;
-	printk("\x1b[33m""#>\t""\x1b[0m""Lock %s: des->%d, proc_id->%d (B:%d)\n",tabla_mutexs[des].nombre,des,p_proc_actual->id,tabla_mutexs[des].estado);
+	prestar_al_propietario(des);
+	fijar_nivel_int(nivel);
+	trazar(TRZ_LOCK, p_proc_actual->id, des);
 
 	return 0;
 }
 
+/*I. Funcion que bloquea el mutex, esperando lo que haga falta */
+int sis_lock(){
+	return lock_mutex((unsigned int)leer_registro(1), 0, 0);
+}
+
+/*I. Funcion que bloquea el mutex esperando como mucho unos milisegundos
+  (con 0 no espera). Errores como lock_mutex */
+int sis_lock_timeout(){
+	unsigned int des=(unsigned int)leer_registro(1);
+	unsigned int ms=(unsigned int)leer_registro(2);
+
+	return lock_mutex(des, 1, ticks_sistema+ms_a_ticks(ms));
+}
+
 /*I. Funcion que desbloquea el proceso pasandole el id del mutex */
 /**
  * ERRORES:
@@ -810,22 +2656,25 @@ int sis_unlock(){
 				tabla_mutexs[des].estado--;
 				//Comprobamos si ya no esta bloqueado:
 				if(tabla_mutexs[des].estado==0){
+					//Los que esperan dejan de prestarle sus tickets:
+					int nivel=fijar_nivel_int(NIVEL_3);
+					retirar_prestamos_mutex(des);
+					fijar_nivel_int(nivel);
 					//Si hay algun proceso esperando el mutex por lock, se le desbloquea
 					if(tabla_mutexs[des].procesos_bloqueados_lock.primero!=NULL){
 						//Guardamos y elevamos el nivel de interrupcion:
 						int nivel_int = fijar_nivel_int(NIVEL_3);
 
-						//Ponemos a listo el proceso que esta esperando:
+						//Lo pasamos de la lista de bloqueados a la de listos (insertar_listo
+						//lo pone en LISTO al ver que despierta):
 						BCP* proc_aux = tabla_mutexs[des].procesos_bloqueados_lock.primero;
-						proc_aux->estado = LISTO;
-
-						//Lo pasamos de la lista de bloqueados a la de listos:
 						eliminar_primero(&tabla_mutexs[des].procesos_bloqueados_lock); 
-						insertar_ultimo(&lista_listos,proc_aux);
+						//Si esperaba con plazo se desarma su temporizador:
+						cancelar_temporizador(&proc_aux->despertador);
+						insertar_listo(proc_aux);
 
 						//Volvemos al nivel de interrupcion:
 						fijar_nivel_int(nivel_int);
-						printk("\x1b[33m""#>\t""\x1b[0m""Unblock %s: des->%d, proc_id->%d (B:%d)\n",tabla_mutexs[des].nombre,des,p_proc_actual->id,tabla_mutexs[des].estado);
 					}
 					//Eliminamos al propietario del mutex:
 					tabla_mutexs[des].id_proc_propietario=-1;
@@ -843,24 +2692,26 @@ int sis_unlock(){
 			if(tabla_mutexs[des].id_proc_propietario==p_proc_actual->id){
 				//Desbloquear:
 				tabla_mutexs[des].estado--;
-				//Eliminar al propietario:
+				//Eliminar al propietario (los que esperan dejan de prestarle sus tickets):
 				tabla_mutexs[des].id_proc_propietario=-1;
+				int nivel=fijar_nivel_int(NIVEL_3);
+				retirar_prestamos_mutex(des);
+				fijar_nivel_int(nivel);
 				//Si hay procesos bloqueados:
 				if(tabla_mutexs[des].procesos_bloqueados_lock.primero!=NULL){
 					//Guardamos y elevamos el nivel de interrupcion:
 					int nivel_int = fijar_nivel_int(NIVEL_3);
 
-					//Ponemos a listo el proceso que esta esperando:
+					//Lo pasamos de la lista de bloqueados a la de listos (insertar_listo
+					//lo pone en LISTO al ver que despierta):
 					BCP* proc_aux = tabla_mutexs[des].procesos_bloqueados_lock.primero;
-					proc_aux->estado = LISTO;
-
-					//Lo pasamos de la lista de bloqueados a la de listos:
 					eliminar_primero(&tabla_mutexs[des].procesos_bloqueados_lock); 
-					insertar_ultimo(&lista_listos,proc_aux);
+					//Si esperaba con plazo se desarma su temporizador:
+					cancelar_temporizador(&proc_aux->despertador);
+					insertar_listo(proc_aux);
 
 					//Volvemos al nivel de interrupcion:
 					fijar_nivel_int(nivel_int);
-					printk("\x1b[33m""#>\t""\x1b[0m""Unblock %s: des->%d, proc_id->%d (B:%d)\n",tabla_mutexs[des].nombre,des,p_proc_actual->id,tabla_mutexs[des].estado);
 				}
 			}
 			//Si no es propietario:
@@ -876,7 +2727,7 @@ int sis_unlock(){
 		return -4;
 	}
 
-	printk("\x1b[33m""#>\t""\x1b[0m""Unlock %s: des->%d, proc_id->%d (B:%d)\n",tabla_mutexs[des].nombre,des,p_proc_actual->id,tabla_mutexs[des].estado);
+	trazar(TRZ_UNLOCK, p_proc_actual->id, des);
 	return 0;
 }
 /*I. Funcion que cierra el mutex pasandole el id del mutex */
@@ -907,11 +2758,541 @@ int sis_cerrar_mutex(){
 	return cerrarMutex(des,posDes);
 }
 
+/*P. Funcion que fija la prioridad de un proceso */
+/**
+ * ERRORES:
+ * -1: El identificador no corresponde a ningun proceso.
+ * -2: La prioridad se sale del rango 0-(NUM_PRIORIDADES-1).
+*/
+int sis_fijar_prioridad(){
+
+	//1.Comprobamos que el proceso existe:
+	unsigned int id=(unsigned int)leer_registro(1);
+	if(id>=MAX_PROC||tabla_procs[id].estado==NO_USADA){
+		printk("\x1b[31m""[SIS_FIJAR_PRIORIDAD] - No existe el proceso %d\n""\x1b[0m",id);
+		return -1;
+	}
+
+	//2.Comprobamos que la prioridad esta dentro del rango:
+	unsigned int prioridad=(unsigned int)leer_registro(2);
+	if(prioridad>=NUM_PRIORIDADES){
+		printk("\x1b[31m""[SIS_FIJAR_PRIORIDAD] - La prioridad no esta dentro del rango 0-%d\n""\x1b[0m",NUM_PRIORIDADES-1);
+		return -2;
+	}
+
+	BCP *proc=&tabla_procs[id];
+	int nivel=fijar_nivel_int(NIVEL_3);
+	//Si esta en la cola de listos se mueve a la lista de su nueva prioridad:
+	if(proc!=p_proc_actual&&proc->estado==LISTO){
+		eliminar_listo(proc);
+		proc->prioridad=prioridad;
+		proc->nivel=prioridad;
+		encolar_listo(proc);
+	}
+	else {
+		proc->prioridad=prioridad;
+		proc->nivel=prioridad;
+	}
+
+	//Si la clase en uso ve ahora uno listo mas urgente que el actual se le expulsa:
+	if(clase->prioridad(proc, actual_normal()))
+		activar_int_SW();
+	fijar_nivel_int(nivel);
+
+	printk("\x1b[33m""#>\t""\x1b[0m""Prioridad: proc_id->%d (P:%d)\n",id,prioridad);
+	return 0;
+}
+
+/*CFS. Funcion que fija el nice de un proceso */
+/**
+ * ERRORES:
+ * -1: El identificador no corresponde a ningun proceso.
+ * -2: El nice se sale del rango NICE_MIN-NICE_MAX.
+*/
+int sis_fijar_nice(){
+
+	//1.Comprobamos que el proceso existe:
+	unsigned int id=(unsigned int)leer_registro(1);
+	if(id>=MAX_PROC||tabla_procs[id].estado==NO_USADA){
+		printk("\x1b[31m""[SIS_FIJAR_NICE] - No existe el proceso %d\n""\x1b[0m",id);
+		return -1;
+	}
+
+	//2.Comprobamos que el nice esta dentro del rango:
+	int nice=(int)leer_registro(2);
+	if(nice<NICE_MIN||nice>NICE_MAX){
+		printk("\x1b[31m""[SIS_FIJAR_NICE] - El nice no esta dentro del rango %d-%d\n""\x1b[0m",NICE_MIN,NICE_MAX);
+		return -2;
+	}
+
+	//El peso solo afecta a lo que se carga en adelante, no a su posicion:
+	tabla_procs[id].nice=nice;
+	tabla_procs[id].peso=peso_nice[nice-NICE_MIN];
+
+	printk("\x1b[33m""#>\t""\x1b[0m""Nice: proc_id->%d (N:%d)\n",id,nice);
+	return 0;
+}
+
+/*STRIDE. Funcion que fija los tickets de un proceso */
+/**
+ * ERRORES:
+ * -1: El identificador no corresponde a ningun proceso.
+ * -2: Los tickets se salen del rango 1-MAX_TICKETS.
+*/
+int sis_fijar_tickets(){
+
+	//1.Comprobamos que el proceso existe:
+	unsigned int id=(unsigned int)leer_registro(1);
+	if(id>=MAX_PROC||tabla_procs[id].estado==NO_USADA){
+		printk("\x1b[31m""[SIS_FIJAR_TICKETS] - No existe el proceso %d\n""\x1b[0m",id);
+		return -1;
+	}
+
+	//2.Comprobamos que los tickets estan dentro del rango:
+	unsigned int tickets=(unsigned int)leer_registro(2);
+	if(tickets==0||tickets>MAX_TICKETS){
+		printk("\x1b[31m""[SIS_FIJAR_TICKETS] - Los tickets no estan dentro del rango 1-%d\n""\x1b[0m",MAX_TICKETS);
+		return -2;
+	}
+
+	int nivel=fijar_nivel_int(NIVEL_3);
+	cambiar_tickets(&tabla_procs[id], tickets);
+	fijar_nivel_int(nivel);
+
+	printk("\x1b[33m""#>\t""\x1b[0m""Tickets: proc_id->%d (T:%d)\n",id,tickets);
+	return 0;
+}
+
+/*STRIDE. Funcion que transfiere tickets del proceso actual a otro */
+/**
+ * ERRORES:
+ * -1: El identificador no corresponde a ningun proceso.
+ * -2: Se intenta transferir 0 tickets o al propio proceso.
+ * -3: El proceso actual se quedaria sin tickets.
+*/
+int sis_transferir_tickets(){
+
+	//1.Comprobamos que el proceso destino existe:
+	unsigned int id=(unsigned int)leer_registro(1);
+	if(id>=MAX_PROC||tabla_procs[id].estado==NO_USADA){
+		printk("\x1b[31m""[SIS_TRANSFERIR_TICKETS] - No existe el proceso %d\n""\x1b[0m",id);
+		return -1;
+	}
+
+	//2.Comprobamos que la transferencia tiene sentido:
+	unsigned int tickets=(unsigned int)leer_registro(2);
+	if(tickets==0||&tabla_procs[id]==p_proc_actual){
+		printk("\x1b[31m""[SIS_TRANSFERIR_TICKETS] - Transferencia no valida\n""\x1b[0m");
+		return -2;
+	}
+
+	//3.Comprobamos que al proceso actual le queda al menos un ticket:
+	if(tickets>=p_proc_actual->tickets){
+		printk("\x1b[31m""[SIS_TRANSFERIR_TICKETS] - El proceso %d solo tiene %d tickets\n""\x1b[0m",p_proc_actual->id,p_proc_actual->tickets);
+		return -3;
+	}
+
+	int nivel=fijar_nivel_int(NIVEL_3);
+	cambiar_tickets(p_proc_actual, p_proc_actual->tickets-tickets);
+	cambiar_tickets(&tabla_procs[id], tabla_procs[id].tickets+tickets);
+	fijar_nivel_int(nivel);
+
+	printk("\x1b[33m""#>\t""\x1b[0m""Transferidos %d tickets: %d->%d\n",tickets,p_proc_actual->id,id);
+	return 0;
+}
+
+/*
+ * EDF. Utilizacion (en coma fija) de un proceso de tiempo real. Si el
+ * plazo es menor que el periodo se usa el plazo.
+ */
+static unsigned long long utilizacion_rt(unsigned int ejecucion,
+			unsigned int periodo, unsigned int plazo){
+	unsigned int divisor=(plazo<periodo)?plazo:periodo;
+
+	return (unsigned long long)ejecucion*ESCALA_UTIL/divisor;
+}
+
+/*EDF. Funcion que declara los parametros de tiempo real del proceso */
+/**
+ * Con ejecucion 0 el proceso vuelve a la planificacion normal.
+ * ERRORES:
+ * -1: Parametros no validos (debe cumplirse 0<ejecucion<=plazo<=periodo).
+ * -2: Admitirlo haria que la utilizacion total superase 1.
+*/
+int sis_fijar_plazo(){
+	unsigned int ejecucion=(unsigned int)leer_registro(1);
+	unsigned int periodo=(unsigned int)leer_registro(2);
+	unsigned int plazo=(unsigned int)leer_registro(3);
+	unsigned long long total;
+	int i;
+
+	//Salida de la clase de tiempo real:
+	if(ejecucion==0){
+		p_proc_actual->tiempo_real=0;
+		printk("\x1b[33m""#>\t""\x1b[0m""Tiempo real: proc_id->%d sale\n",p_proc_actual->id);
+		return 0;
+	}
+
+	//1.Comprobamos que los parametros son coherentes:
+	if(ejecucion>plazo||plazo>periodo){
+		printk("\x1b[31m""[SIS_FIJAR_PLAZO] - Parametros no validos (%d,%d,%d)\n""\x1b[0m",ejecucion,periodo,plazo);
+		return -1;
+	}
+
+	//2.Control de admision: la utilizacion total no puede superar 1:
+	total=utilizacion_rt(ejecucion, periodo, plazo);
+	for(i=0;i<MAX_PROC;i++){
+		BCP *proc=&tabla_procs[i];
+		if(proc!=p_proc_actual&&proc->estado!=NO_USADA&&proc->tiempo_real)
+			total+=utilizacion_rt(proc->rt_ejecucion,proc->rt_periodo,proc->rt_plazo);
+	}
+	if(total>ESCALA_UTIL){
+		printk("\x1b[31m""[SIS_FIJAR_PLAZO] - Rechazado: la utilizacion superaria 1\n""\x1b[0m");
+		return -2;
+	}
+
+	//El proceso en ejecucion no esta en ninguna cola, basta con fijar sus datos:
+	int nivel=fijar_nivel_int(NIVEL_3);
+	p_proc_actual->rt_ejecucion=ejecucion;
+	p_proc_actual->rt_periodo=periodo;
+	p_proc_actual->rt_plazo=plazo;
+	p_proc_actual->tiempo_real=1;
+	nuevo_periodo_rt(p_proc_actual, ticks_sistema);
+	fijar_nivel_int(nivel);
+
+	printk("\x1b[33m""#>\t""\x1b[0m""Tiempo real: proc_id->%d (C:%d T:%d D:%d)\n",p_proc_actual->id,ejecucion,periodo,plazo);
+	return 0;
+}
+
+/*C. Funcion que devuelve la contabilidad de UCP de un proceso */
+/**
+ * Copia en la estructura del usuario una instantanea de los contadores.
+ * ERRORES:
+ * -1: No existe el proceso.
+ * -2: La direccion de destino es nula.
+*/
+int sis_obtener_info_cpu(){
+
+	//1.Comprobamos que el proceso existe (sin mensaje, ya que se usa para
+	//recorrer la tabla de procesos):
+	unsigned int id=(unsigned int)leer_registro(1);
+	if(id>=MAX_PROC||tabla_procs[id].estado==NO_USADA)
+		return -1;
+
+	//2.Comprobamos el destino:
+	info_cpu *info=(info_cpu *)leer_registro(2);
+	if(info==NULL){
+		printk("\x1b[31m""[SIS_OBTENER_INFO_CPU] - Direccion de destino nula\n""\x1b[0m");
+		return -2;
+	}
+
+	BCP *proc=&tabla_procs[id];
+	int nivel=fijar_nivel_int(NIVEL_3);
+	*info=proc->cpu;
+	info->nivel=proc->nivel;
+	info->tickets=proc->tickets;
+	//Si sigue en la cola de listos, su espera actual aun no se ha sumado:
+	if(proc!=p_proc_actual&&proc->estado==LISTO){
+		unsigned int espera=(unsigned int)(ticks_sistema-proc->tick_listo);
+		info->ticks_espera+=espera;
+		if(espera>info->espera_maxima)
+			info->espera_maxima=espera;
+	}
+	fijar_nivel_int(nivel);
+	return 0;
+}
+
+/*T. Funcion que vuelca por el terminal la traza del planificador */
+int sis_volcar_traza(){
+	volcar_traza();
+	return 0;
+}
+
+/*CE. Funcion que cede la UCP: el proceso pasa al final de la cola de listos */
+int sis_ceder(){
+	int nivel=fijar_nivel_int(NIVEL_3);
+	//No se degrada ni se promociona: conserva su nivel:
+	insertar_listo(p_proc_actual);
+	cambioProcesoA(NULL, NULL, 1);
+	fijar_nivel_int(nivel);
+	return 0;
+}
+
+/*CE. Funcion que cede lo que queda de la rodaja a un proceso listo */
+/**
+ * ERRORES:
+ * -1: No existe el proceso, no esta listo o es el propio proceso.
+*/
+int sis_ceder_a(){
+	unsigned int id=(unsigned int)leer_registro(1);
+	if(id>=MAX_PROC||tabla_procs[id].estado!=LISTO||&tabla_procs[id]==p_proc_actual){
+		printk("\x1b[31m""[SIS_CEDER_A] - El proceso %d no esta listo\n""\x1b[0m",id);
+		return -1;
+	}
+
+	int nivel=fijar_nivel_int(NIVEL_3);
+	insertar_listo(p_proc_actual);
+	cambioProcesoA(NULL, &tabla_procs[id], 1);
+	fijar_nivel_int(nivel);
+	return 0;
+}
+
+/*L. Funcion que devuelve las estadisticas de carga */
+/**
+ * ERRORES:
+ * -1: La direccion de destino es nula.
+*/
+int sis_obtener_carga(){
+	info_carga *info=(info_carga *)leer_registro(1);
+	int i;
+
+	if(info==NULL){
+		printk("\x1b[31m""[SIS_OBTENER_CARGA] - Direccion de destino nula\n""\x1b[0m");
+		return -1;
+	}
+
+	int nivel=fijar_nivel_int(NIVEL_3);
+	for(i=0;i<3;i++)
+		info->carga[i]=media_carga[i];
+	info->listos=longitud_listos();
+	info->dormidos=num_dormidos;
+	info->esperando_mutex=lista_bloqueados.n;
+	for(i=0;i<NUM_MUT;i++)
+		info->esperando_mutex+=tabla_mutexs[i].procesos_bloqueados_lock.n;
+	for(i=0;i<TAM_HISTOGRAMA;i++)
+		info->histograma[i]=histograma_listos[i];
+	fijar_nivel_int(nivel);
+	return 0;
+}
+
+/*CL. Funcion que fija la clase de planificacion de un proceso */
+/**
+ * ERRORES:
+ * -1: El identificador no corresponde a ningun proceso.
+ * -2: La clase no es ninguna de CLASE_NORMAL, CLASE_FIFO, CLASE_LOTE o CLASE_OCIOSA.
+*/
+int sis_fijar_politica(){
+
+	//1.Comprobamos que el proceso existe:
+	unsigned int id=(unsigned int)leer_registro(1);
+	if(id>=MAX_PROC||tabla_procs[id].estado==NO_USADA){
+		printk("\x1b[31m""[SIS_FIJAR_POLITICA] - No existe el proceso %d\n""\x1b[0m",id);
+		return -1;
+	}
+
+	//2.Comprobamos que la clase existe:
+	unsigned int clase_nueva=(unsigned int)leer_registro(2);
+	if(clase_nueva>=NUM_CLASES){
+		printk("\x1b[31m""[SIS_FIJAR_POLITICA] - La clase %d no existe\n""\x1b[0m",clase_nueva);
+		return -2;
+	}
+
+	BCP *proc=&tabla_procs[id];
+	int nivel=fijar_nivel_int(NIVEL_3);
+	//Si esta en la cola de listos se mueve a la de su nueva clase:
+	if(proc!=p_proc_actual&&proc->estado==LISTO){
+		eliminar_listo(proc);
+		proc->clase_proc=clase_nueva;
+		encolar_listo(proc);
+	}
+	else {
+		proc->clase_proc=clase_nueva;
+		//Si es el actual empieza una rodaja de su nueva clase y se le
+		//expulsa si hay un proceso listo de una clase que va antes:
+		if(proc==p_proc_actual){
+			iniciar_rodaja(proc);
+			BCP *primero=primer_listo();
+			if(primero&&rango_clase(primero)<rango_clase(proc))
+				activar_int_SW();
+		}
+	}
+	fijar_nivel_int(nivel);
+
+	printk("\x1b[33m""#>\t""\x1b[0m""Clase: proc_id->%d (C:%d)\n",id,clase_nueva);
+	return 0;
+}
+
+/*AV. Funcion que fija el aviso de no expulsion del proceso actual (NULL lo
+  anula). No hace falta llamarla otra vez para cada seccion critica: basta
+  con escribir en el aviso*/
+int sis_fijar_aviso_expulsion(){
+	aviso_expulsion *aviso=(aviso_expulsion *)leer_registro(1);
+
+	int nivel=fijar_nivel_int(NIVEL_3);
+	p_proc_actual->aviso=aviso;
+	if(aviso)
+		aviso->ceder_pendiente=0;
+	fijar_nivel_int(nivel);
+
+	return 0;
+}
+
+/*GRUPOS. Funcion que crea un grupo de procesos vacio con el peso indicado y
+  devuelve su identificador. Si nadie entra en el se libera al terminar
+  quien lo creo*/
+/**
+ * ERRORES:
+ * -1: No quedan grupos libres.
+ * -2: El peso se sale del rango 1-MAX_PESO_GRUPO.
+*/
+int sis_crear_grupo(){
+	unsigned int peso=(unsigned int)leer_registro(1);
+	int i;
+
+	//1.Comprobamos que el peso esta dentro del rango:
+	if(peso==0||peso>MAX_PESO_GRUPO){
+		printk("\x1b[31m""[SIS_CREAR_GRUPO] - El peso no esta dentro del rango 1-%d\n""\x1b[0m",MAX_PESO_GRUPO);
+		return -2;
+	}
+
+	//2.Buscamos un grupo libre:
+	for(i=0;i<MAX_GRUPOS&&tabla_grupos[i].usado;i++);
+	if(i==MAX_GRUPOS){
+		printk("\x1b[31m""[SIS_CREAR_GRUPO] - No quedan grupos libres\n""\x1b[0m");
+		return -1;
+	}
+
+	int nivel=fijar_nivel_int(NIVEL_3);
+	tabla_grupos[i].usado=1;
+	tabla_grupos[i].peso=peso;
+	tabla_grupos[i].zancada=STRIDE1/peso;
+	tabla_grupos[i].pase=pase_minimo_grupos;
+	tabla_grupos[i].n_procs=0;
+	tabla_grupos[i].creador=p_proc_actual;
+	tabla_grupos[i].listos.primero=NULL;
+	tabla_grupos[i].listos.ultimo=NULL;
+	tabla_grupos[i].listos.n=0;
+	fijar_nivel_int(nivel);
+
+	printk("\x1b[33m""#>\t""\x1b[0m""Grupo: %d creado (W:%d)\n",i,peso);
+	return i;
+}
+
+/*GRUPOS. Funcion que pasa el proceso actual al grupo indicado. Sus hijos
+  posteriores heredan el grupo*/
+/**
+ * ERRORES:
+ * -1: El grupo no existe.
+*/
+int sis_unirse_grupo(){
+	unsigned int id=(unsigned int)leer_registro(1);
+
+	if(id>=MAX_GRUPOS||!tabla_grupos[id].usado){
+		printk("\x1b[31m""[SIS_UNIRSE_GRUPO] - No existe el grupo %d\n""\x1b[0m",id);
+		return -1;
+	}
+
+	//El proceso en ejecucion no esta en ninguna cola, basta con cambiarlo:
+	int nivel=fijar_nivel_int(NIVEL_3);
+	if(p_proc_actual->grupo!=(int)id){
+		salir_grupo(p_proc_actual);
+		entrar_grupo(p_proc_actual, id);
+	}
+	fijar_nivel_int(nivel);
+
+	printk("\x1b[33m""#>\t""\x1b[0m""Grupo: proc_id->%d (G:%d)\n",p_proc_actual->id,id);
+	return 0;
+}
+
+/*AG. Funcion que registra al proceso actual como agente de planificacion con
+  el anillo indicado (NULL lo retira). El agente pasa a la clase FIFO para
+  atender los eventos en cuanto se producen*/
+/**
+ * ERRORES:
+ * -1: Ya hay otro agente registrado.
+ * -2: El papel de agente esta reservado a otro proceso.
+*/
+int sis_registrar_agente(){
+	anillo_agente *a=(anillo_agente *)leer_registro(1);
+
+	int nivel=fijar_nivel_int(NIVEL_3);
+	if(a==NULL){
+		if(agente==p_proc_actual)
+			soltar_agente("se retira");
+		fijar_nivel_int(nivel);
+		return 0;
+	}
+	if(agente&&agente!=p_proc_actual){
+		fijar_nivel_int(nivel);
+		printk("\x1b[31m""[SIS_REGISTRAR_AGENTE] - Ya hay un agente: %d\n""\x1b[0m",agente->id);
+		return -1;
+	}
+	//Solo puede registrarse el primer proceso que lo hizo mientras viva:
+	if(titular_agente&&titular_agente!=p_proc_actual){
+		fijar_nivel_int(nivel);
+		printk("\x1b[31m""[SIS_REGISTRAR_AGENTE] - El papel de agente esta reservado al proceso %d\n""\x1b[0m",titular_agente->id);
+		return -2;
+	}
+
+	a->cabeza=0;
+	a->cola=0;
+	a->perdidos=0;
+	a->decision=-1;
+	anillo=a;
+	agente=p_proc_actual;
+	titular_agente=p_proc_actual;
+	agente->clase_proc=CLASE_FIFO;
+	agente->fin_rodaja=(unsigned long long)-1;
+	fijar_nivel_int(nivel);
+
+	printk("\x1b[33m""#>\t""\x1b[0m""Agente: proc_id->%d\n",p_proc_actual->id);
+	return 0;
+}
+
+/*AG. Funcion que bloquea al agente hasta que haya eventos sin atender en el
+  anillo y devuelve cuantos hay*/
+/**
+ * ERRORES:
+ * -1: El proceso no es el agente (o se le ha retirado mientras esperaba).
+*/
+int sis_esperar_eventos(){
+	int n;
+
+	int nivel=fijar_nivel_int(NIVEL_3);
+	if(agente!=p_proc_actual){
+		fijar_nivel_int(nivel);
+		return -1;
+	}
+	if(anillo->cabeza==anillo->cola){
+		p_proc_actual->estado=BLOQUEADO;
+		trazar(TRZ_BLOQUEO, p_proc_actual->id, BLQ_AGENTE);
+		cambioProceso(&lista_agente);
+	}
+	n=(agente==p_proc_actual) ? (int)(anillo->cabeza-anillo->cola) : -1;
+	fijar_nivel_int(nivel);
+
+	return n;
+}
+
 /*
  *
  * Rutina de inicializaci�n invocada en arranque
  *
  */
+
+/*
+ * Elige la clase de planificacion segun la variable de entorno POLITICA
+ * (nombre de una de tabla_clases). Si no esta definida o no existe se
+ * queda la de POLITICA.
+ */
+static void elegir_politica(){
+	char *nombre=getenv("POLITICA");
+	int i;
+
+	if (nombre!=NULL) {
+		for (i=0; i<NUM_POLITICAS; i++)
+			if (strcmp(nombre, tabla_clases[i].nombre)==0)
+				break;
+		if (i<NUM_POLITICAS) {
+			politica=i;
+			clase=&tabla_clases[i];
+		}
+		else
+			printk("\x1b[31m""[ARRANQUE] - Politica %s desconocida\n""\x1b[0m", nombre);
+	}
+	printk("\x1b[32m""[ARRANQUE] - Politica de planificacion: %s\n""\x1b[0m", clase->nombre);
+}
+
 int main(){
 	/* se llega con las interrupciones prohibidas */
 
@@ -928,6 +3309,8 @@ int main(){
 
 	iniciar_tabla_proc();		/* inicia BCPs de tabla de procesos */
 	iniciar_tabla_mutexs();     /* I. inciar tabla de mutexs*/
+	iniciar_tabla_grupos();		/* inicia la tabla de grupos de procesos */
+	elegir_politica();		/* clase de planificacion en uso */
 
 	/* crea proceso inicial */
 	if (crear_tarea((void *)"init")<0)
@@ -935,6 +3318,10 @@ int main(){
 	
 	/* activa proceso inicial */
 	p_proc_actual=planificador();
+	iniciar_rodaja(p_proc_actual);
+	p_proc_actual->tick_rafaga=ticks_sistema;
+	pagina_compartida.reloj_base=leer_reloj_CMOS();
+	actualizar_pagina();
 	cambio_contexto(NULL, &(p_proc_actual->contexto_regs));
 	panico("S.O. reactivado inesperadamente");
 	return 0;
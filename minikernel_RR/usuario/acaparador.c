@@ -0,0 +1,22 @@
+/*
+ * usuario/acaparador.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que crea grupos hasta agotarlos sin entrar en
+ * ninguno y termina. Al terminar se deben liberar todos.
+ */
+
+#include "servicios.h"
+
+int main(){
+	int n=0;
+
+	while (crear_grupo(1)>=0)
+		n++;
+	printf("acaparador: crea %d grupos sin usarlos y termina\n", n);
+	return 0; 
+}
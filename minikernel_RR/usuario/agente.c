@@ -0,0 +1,74 @@
+/*
+ * usuario/agente.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que hace de agente de planificacion: sigue por los
+ * eventos del anillo que procesos estan listos y decide ejecutar siempre
+ * el de menor identificador. Los procesos anteriores al agente los
+ * conoce por su primer evento. Termina cuando han terminado todos los
+ * procesos creados despues de registrarse.
+ */
+
+#include "servicios.h"
+
+#define NUM_PROCS 10	/* tamaño de la tabla de procesos del kernel */
+
+int main(){
+	int i, vivos=0, creados=0, decisiones=0;
+	int listo[NUM_PROCS], nacido[NUM_PROCS];
+	anillo_agente anillo;
+	evento_agente *evt;
+
+	for (i=0; i<NUM_PROCS; i++)
+		listo[i]=nacido[i]=0;
+
+	if (registrar_agente(&anillo)<0)
+		printf("agente: error registrandose. NO DEBE APARECER\n");
+
+	while (creados==0 || vivos>0) {
+		if (esperar_eventos()<0) {
+			printf("agente: se le ha retirado\n");
+			break;
+		}
+		while (anillo.cola!=anillo.cabeza) {
+			evt=&anillo.eventos[anillo.cola%TAM_ANILLO_AGENTE];
+			switch (evt->tipo) {
+			case EVT_NUEVO:
+				nacido[evt->proc]=1;
+				vivos++;
+				creados++;
+				listo[evt->proc]=1;
+				break;
+			case EVT_DESPERTAR:
+			case EVT_EXPULSION:
+				listo[evt->proc]=1;
+				break;
+			case EVT_BLOQUEO:
+				listo[evt->proc]=0;
+				break;
+			case EVT_FIN:
+				if (nacido[evt->proc])
+					vivos--;
+				nacido[evt->proc]=listo[evt->proc]=0;
+				break;
+			}
+			anillo.cola++;
+		}
+
+		/* el listo de menor identificador */
+		for (i=0; i<NUM_PROCS && !listo[i]; i++);
+		if (i<NUM_PROCS) {
+			anillo.decision=i;
+			decisiones++;
+		}
+	}
+
+	registrar_agente(0);
+	printf("agente: termina tras %d decisiones, %d eventos perdidos\n",
+		decisiones, anillo.perdidos);
+	return 0;
+}
@@ -0,0 +1,33 @@
+/*
+ * usuario/bloqueado_urgente.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario de maxima prioridad que espera en un lock: debe
+ * conseguir el mutex en el mismo tick en que se libera. El tiempo que ha
+ * pasado bloqueado no cuenta como espera en la cola de listos.
+ */
+
+#include "servicios.h"
+
+int main(){
+	int des;
+	info_cpu info;
+
+	fijar_prioridad(obtener_id_pr(), PRIORIDAD_MAXIMA);
+	if ((des=abrir_mutex("urgente"))<0)
+		printf("bloqueado_urgente: error abriendo mutex. NO DEBE APARECER\n");
+
+	lock(des);
+	printf("bloqueado_urgente: consigue el mutex en el tick %d\n",
+		obtener_ticks());
+	obtener_info_cpu(obtener_id_pr(), &info);
+	printf("bloqueado_urgente: espera maxima en listos %d ticks (debe ser 0)\n",
+		info.espera_maxima);
+	unlock(des);
+	cerrar_mutex(des);
+	return 0;
+}
@@ -0,0 +1,27 @@
+/*
+ * usuario/cedente.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que cede la UCP tras cada iteracion: varios
+ * cedentes deben alternarse sin esperar a que venza su rodaja.
+ */
+
+#include "servicios.h"
+
+#define TOT_ITER 5
+
+int main(){
+	int i, id;
+
+	id=obtener_id_pr();
+	for (i=0; i<TOT_ITER; i++) {
+		printf("cedente (%d): iteracion %d\n", id, i);
+		ceder();
+	}
+	printf("cedente (%d): termina\n", id);
+	return 0;
+}
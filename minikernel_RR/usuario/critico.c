@@ -0,0 +1,49 @@
+/*
+ * usuario/critico.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que entra muchas veces en una seccion critica corta
+ * protegida por el mutex "seccion" avisando de que no se le expulse. Al
+ * terminar muestra sus cambios de proceso y cuantas veces cedio la UCP al
+ * salir por habersele prorrogado la rodaja.
+ */
+
+#include "servicios.h"
+
+#define VECES 1000
+#define ITER_DENTRO 100000
+#define ITER_FUERA 200000
+
+int main(){
+	int i, j, id, desc, cesiones=0, tot=0;
+	aviso_expulsion aviso={0, 0};
+	info_cpu info;
+
+	id=obtener_id_pr();
+	if ((desc=abrir_mutex("seccion"))<0)
+		printf("critico (%d): error abriendo seccion. NO DEBE APARECER\n", id);
+	if (fijar_aviso_expulsion(&aviso)<0)
+		printf("critico (%d): error fijando el aviso. NO DEBE APARECER\n", id);
+
+	for (i=0; i<VECES; i++) {
+		lock(desc);
+		entrar_seccion(&aviso);
+		for (j=0; j<ITER_DENTRO; j++)
+			tot+=j&1;
+		unlock(desc);
+		cesiones+=salir_seccion(&aviso);
+
+		for (j=0; j<ITER_FUERA; j++)
+			tot+=j&1;
+	}
+	fijar_aviso_expulsion(0);
+
+	obtener_info_cpu(id, &info);
+	printf("critico (%d): termina con %d, %d cambios voluntarios, %d expulsiones, %d cesiones\n",
+		id, tot, info.cambios_voluntarios, info.cambios_involuntarios, cesiones);
+	return 0;
+}
@@ -0,0 +1,41 @@
+/*
+ * usuario/impaciente.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que intenta conseguir un mutex ocupado con plazos:
+ * los dos primeros intentos deben vencer y el tercero conseguirlo.
+ */
+
+#include "servicios.h"
+
+int main(){
+	int des, res;
+	unsigned int t0;
+
+	if ((des=abrir_mutex("plazo"))<0)
+		printf("impaciente: error abriendo mutex. NO DEBE APARECER\n");
+
+	t0=obtener_ticks();
+	res=lock_timeout(des, 300);
+	printf("impaciente: lock_timeout(300) devuelve %d tras %d ticks\n",
+		res, obtener_ticks()-t0);
+
+	t0=obtener_ticks();
+	res=lock_timeout(des, 0);
+	printf("impaciente: lock_timeout(0) devuelve %d tras %d ticks\n",
+		res, obtener_ticks()-t0);
+
+	t0=obtener_ticks();
+	res=lock_timeout(des, 5000);
+	printf("impaciente: lock_timeout(5000) devuelve %d tras %d ticks (tick %d)\n",
+		res, obtener_ticks()-t0, obtener_ticks());
+	if (res==0)
+		unlock(des);
+
+	cerrar_mutex(des);
+	return 0;
+}
@@ -33,22 +33,211 @@ int escribir(char *texto, unsigned int longi);
 int obtener_id_pr();
 /*I. Funcion que duerme el proceso */
 int dormir(unsigned int segundos);
+/*I. Funcion que duerme el proceso unos milisegundos (se redondean al
+  tick siguiente) */
+int dormir_ms(unsigned int ms);
+/*I. Funcion que duerme el proceso hasta el tick absoluto indicado (-1 si
+  ya ha pasado): sirve para bucles periodicos que no derivan */
+int dormir_hasta(unsigned int tick);
+/*I. Funcion que devuelve los ticks desde el arranque (TICKS_POR_SEGUNDO
+  por segundo) */
+unsigned int obtener_ticks();
+#define TICKS_POR_SEGUNDO 100 /* debe coincidir con TICK del kernel */
+/*I. Funcion que arma la alarma del proceso para dentro de ms milisegundos,
+  que se repite cada ms si es periodica (0 la desarma). Sustituye a la
+  anterior */
+int alarma(unsigned int ms, int periodica);
+/*I. Funcion que espera a que venza la alarma (sin bloquearse si ya ha
+  vencido) y devuelve cuantas veces ha vencido desde la ultima llamada
+  (-1 si no hay alarma) */
+int esperar_alarma();
+/*I. Funcion que devuelve la hora del reloj CMOS en ms (con resolucion de un
+  tick, 0 si no se puede leer la pagina compartida) */
+unsigned long long obtener_reloj_ms();
+
+/* Pagina compartida con el nucleo, que la actualiza en cada tick y cambio
+   de proceso: obtener_id_pr, obtener_ticks y obtener_reloj_ms la leen sin
+   llamada al sistema. Debe coincidir con la del kernel */
+typedef struct {
+	volatile unsigned int secuencia;		/* impar mientras el nucleo escribe */
+	volatile int id_actual;					/* proceso en ejecucion */
+	volatile unsigned long long ticks;		/* ticks desde el arranque */
+	volatile unsigned long long reloj_base;	/* ms del reloj CMOS en el tick 0 */
+} pagina_nucleo;
 
 /* Funciones del mutex: */
 #define NO_RECURSIVO 0
 #define RECURSIVO 1
+#define PLAZO_VENCIDO -4 /* error de las variantes con plazo (debe coincidir
+			    con el del kernel) */
 
 /*I. Funcion que crea un mutex pasandole el nombre y el tipo */
 int crear_mutex(char *nombre, int tipo);
+/*I. Funcion que crea un mutex esperando como mucho ms milisegundos a que
+  haya uno libre (con 0 no espera): si vence devuelve PLAZO_VENCIDO */
+int crear_mutex_timeout(char *nombre, int tipo, unsigned int ms);
 /*I. Funcion que abre un mutex pasandole el nombre que lo identifica */
 int abrir_mutex(char *nombre);
 /*I. Funcion que bloquea el proceso pasandole el id del mutex */
 int lock(unsigned int mutexid);
+/*I. Funcion que bloquea el mutex esperando como mucho ms milisegundos
+  (con 0 no espera): si vence devuelve PLAZO_VENCIDO */
+int lock_timeout(unsigned int mutexid, unsigned int ms);
 /*I. Funcion que desbloquea el proceso pasandole el id del mutex */
 int unlock(unsigned int mutexid);
 /*I. Funcion que cierra el mutex pasandole el id del mutex */
 int cerrar_mutex(unsigned int mutexid);
 
+/* Funciones de prioridad: */
+#define PRIORIDAD_MAXIMA 0
+#define PRIORIDAD_MINIMA 7
+
+/*P. Funcion que fija la prioridad de un proceso (0 la mas urgente) */
+int fijar_prioridad(unsigned int id, unsigned int prioridad);
+
+/* Funciones de la planificacion justa (CFS): */
+#define NICE_MIN -20
+#define NICE_MAX 19
+
+/*CFS. Funcion que fija el nice de un proceso (-20 a 19) */
+int fijar_nice(unsigned int id, int nice);
+
+/* Funciones del reparto proporcional por tickets (STRIDE): */
+#define MAX_TICKETS 10000
+
+/*STRIDE. Funcion que fija los tickets de un proceso */
+int fijar_tickets(unsigned int id, unsigned int tickets);
+/*STRIDE. Funcion que transfiere tickets del proceso actual a otro */
+int transferir_tickets(unsigned int id, unsigned int tickets);
+
+/* Funciones de la clase de tiempo real por plazos (EDF): */
+
+/*EDF. Funcion que declara los parametros de tiempo real del proceso,
+  en ticks. Con ejecucion 0 vuelve a la planificacion normal */
+int fijar_plazo(unsigned int ejecucion, unsigned int periodo, unsigned int plazo);
+
+/* Funciones de contabilidad de UCP: */
+
+/* Uso de UCP de un proceso en ticks (debe coincidir con la del kernel) */
+typedef struct {
+	unsigned int ticks_usuario;				/* ticks ejecutando en modo usuario */
+	unsigned int ticks_nucleo;				/* ticks ejecutando en modo sistema */
+	unsigned int ticks_espera;				/* ticks en LISTO esperando la UCP */
+	unsigned int cambios_voluntarios;		/* veces que ha cedido la UCP al bloquearse */
+	unsigned int cambios_involuntarios;		/* veces que ha sido expulsado */
+	unsigned int espera_maxima;				/* mayor espera en LISTO antes de ejecutar */
+	unsigned int ultima_rafaga;				/* ticks que ejecuto la ultima vez que tuvo la UCP */
+	unsigned int rafaga_prevista;			/* media movil de sus rafagas (coma fija,
+											   FIJO_RAFAGA es 1 tick) */
+	unsigned int nivel;						/* MLFQ. nivel actual en la cola de listos
+											   (se rellena al consultarlo) */
+	unsigned int tickets;					/* STRIDE. tickets actuales, con los que
+											   le prestan (se rellena al consultarlo) */
+} info_cpu;
+
+#define FIJO_RAFAGA 16 /* rafaga de 1 tick en coma fija */
+
+/*C. Funcion que obtiene la contabilidad de UCP de un proceso */
+int obtener_info_cpu(unsigned int id, info_cpu *info);
+
+/*T. Funcion que vuelca por el terminal la traza del planificador (se
+  convierte con herramientas/traza_json) */
+int volcar_traza();
+
+/* Funciones de cesion de la UCP: */
+
+/*CE. Funcion que cede la UCP pasando al final de la cola de listos */
+int ceder();
+/*CE. Funcion que cede lo que queda de la rodaja a un proceso listo */
+int ceder_a(unsigned int id);
+
+/* Funciones de estadisticas de carga: */
+#define FIJO_CARGA 65536 /* carga 1 en coma fija */
+#define TAM_HISTOGRAMA 11 /* longitudes posibles de la cola de listos */
+
+/* Estadisticas de carga (debe coincidir con la del kernel) */
+typedef struct {
+	unsigned int carga[3];		/* media de procesos listos o en ejecucion a
+								   1s, 10s y 60s (coma fija, FIJO_CARGA es 1) */
+	unsigned int listos;		/* longitud actual de la cola de listos */
+	unsigned int dormidos;		/* procesos dormidos */
+	unsigned int esperando_mutex;	/* procesos esperando por un mutex */
+	unsigned int histograma[TAM_HISTOGRAMA];	/* ticks con i procesos en
+												   la cola de listos */
+} info_carga;
+
+/*L. Funcion que obtiene las estadisticas de carga del sistema */
+int obtener_carga(info_carga *info);
+
+/* Funciones de clases de planificacion (deben coincidir con las del kernel): */
+#define CLASE_NORMAL 0 /* la politica elegida al arrancar */
+#define CLASE_FIFO 1 /* tiempo real FIFO: por delante de los normales */
+#define CLASE_LOTE 2 /* rodaja larga, nunca expulsa al despertar */
+#define CLASE_OCIOSA 3 /* solo ejecuta si no hay ningun otro listo */
+
+/*CL. Funcion que fija la clase de planificacion de un proceso */
+int fijar_politica(unsigned int id, unsigned int clase);
+
+/* Funciones del aviso de no expulsion: */
+
+/* Aviso compartido con el nucleo (debe coincidir con el del kernel) */
+typedef struct {
+	volatile int en_seccion;				/* lo escribe el proceso */
+	volatile int ceder_pendiente;			/* lo escribe el nucleo */
+} aviso_expulsion;
+
+/*AV. Funcion que registra el aviso de no expulsion del proceso (NULL lo anula) */
+int fijar_aviso_expulsion(aviso_expulsion *aviso);
+/*AV. Funcion que marca la entrada en una seccion critica corta (sin llamada al
+  sistema): si vence la rodaja dentro se prorroga una vez */
+void entrar_seccion(aviso_expulsion *aviso);
+/*AV. Funcion que marca la salida de la seccion critica y cede la UCP si se ha
+  prorrogado la rodaja. Devuelve 1 si ha cedido */
+int salir_seccion(aviso_expulsion *aviso);
+
+/* Funciones de los grupos de procesos (reparto justo con POLITICA=grupos): */
+#define MAX_PESO_GRUPO 10000
+
+/*GRUPOS. Funcion que crea un grupo de procesos vacio con el peso indicado (1 a
+  MAX_PESO_GRUPO) y devuelve su identificador. Si nadie entra en el se
+  libera al terminar quien lo creo */
+int crear_grupo(unsigned int peso);
+/*GRUPOS. Funcion que pasa el proceso actual a un grupo. Los procesos que cree a
+  partir de entonces heredan el grupo */
+int unirse_grupo(unsigned int id);
+
+/* Funciones del agente de planificacion (deben coincidir con las del kernel): */
+#define TAM_ANILLO_AGENTE 32
+#define EVT_NUEVO 0 /* se ha creado el proceso */
+#define EVT_DESPERTAR 1 /* el proceso pasa de bloqueado a listo */
+#define EVT_BLOQUEO 2 /* el proceso se bloquea */
+#define EVT_EXPULSION 3 /* el proceso vuelve a la cola de listos expulsado */
+#define EVT_FIN 4 /* el proceso termina */
+
+typedef struct {
+	int tipo;						/* EVT_* */
+	int proc;						/* proceso al que se refiere */
+	unsigned int tick;				/* tick en el que se produjo */
+} evento_agente;
+
+/* Anillo compartido con el nucleo: el agente consume los eventos
+   avanzando cola y deja en decision el proceso que debe ejecutar */
+typedef struct {
+	volatile unsigned int cabeza;	/* eventos publicados (lo escribe el nucleo) */
+	volatile unsigned int cola;		/* eventos consumidos (lo escribe el agente) */
+	volatile unsigned int perdidos;	/* eventos que no cabian en el anillo */
+	volatile int decision;			/* proceso a ejecutar (-1 ninguno) */
+	evento_agente eventos[TAM_ANILLO_AGENTE];
+} anillo_agente;
+
+/*AG. Funcion que registra al proceso como agente de planificacion (NULL lo
+  retira). Si tarda en atender los eventos o no cede la UCP se le retira.
+  Solo puede ser agente el primer proceso que se registra, mientras viva */
+int registrar_agente(anillo_agente *anillo);
+/*AG. Funcion que bloquea al agente hasta que haya eventos en su anillo y
+  devuelve cuantos hay (-1 si ya no es el agente) */
+int esperar_eventos();
+
 
 #endif /* SERVICIOS_H */
 
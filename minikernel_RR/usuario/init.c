@@ -75,6 +75,106 @@ ALGO COMENTE ESTA PARTE Y DESCOMENTE LA PRUEBA CORRESPONDIENTE */
 		printf("Error creando prueba_RR2\n");
 /**/
 
+/* PRUEBA DE LA COLA DE LISTOS MULTIPRIORIDAD
+	if (crear_proceso("prueba_prioridad")<0)
+		printf("Error creando prueba_prioridad\n");
+*/
+
+/* PRUEBA DEL REPARTO PROPORCIONAL POR TICKETS
+	if (crear_proceso("prueba_tickets")<0)
+		printf("Error creando prueba_tickets\n");
+*/
+
+/* PRUEBA DE LA CLASE DE TIEMPO REAL POR PLAZOS
+	if (crear_proceso("prueba_plazos")<0)
+		printf("Error creando prueba_plazos\n");
+*/
+
+/* PRUEBA DE LA CONTABILIDAD DE UCP
+	if (crear_proceso("prueba_cpu")<0)
+		printf("Error creando prueba_cpu\n");
+*/
+
+/* PRUEBA DE LA TRAZA DEL PLANIFICADOR
+	if (crear_proceso("prueba_traza")<0)
+		printf("Error creando prueba_traza\n");
+*/
+
+/* PRUEBA DE LA CESION DE LA UCP
+	if (crear_proceso("prueba_ceder")<0)
+		printf("Error creando prueba_ceder\n");
+*/
+
+/* PRUEBA DE LA EXPULSION AL DESPERTAR
+	if (crear_proceso("prueba_despertar")<0)
+		printf("Error creando prueba_despertar\n");
+*/
+
+/* PRUEBA DE LAS ESTADISTICAS DE CARGA
+	if (crear_proceso("prueba_carga")<0)
+		printf("Error creando prueba_carga\n");
+*/
+
+/* PRUEBA DEL ENVEJECIMIENTO
+	if (crear_proceso("prueba_envejecimiento")<0)
+		printf("Error creando prueba_envejecimiento\n");
+*/
+
+/* PRUEBA DE LAS CLASES DE PLANIFICACION
+	if (crear_proceso("prueba_clases")<0)
+		printf("Error creando prueba_clases\n");
+*/
+
+/* PRUEBA DEL AVISO DE NO EXPULSION
+	if (crear_proceso("prueba_aviso")<0)
+		printf("Error creando prueba_aviso\n");
+*/
+
+/* PRUEBA DE LOS GRUPOS DE PROCESOS (arrancar con POLITICA=grupos)
+	if (crear_proceso("prueba_grupos")<0)
+		printf("Error creando prueba_grupos\n");
+*/
+
+/* PRUEBA DEL AGENTE DE PLANIFICACION
+	if (crear_proceso("prueba_agente")<0)
+		printf("Error creando prueba_agente\n");
+*/
+
+/* PRUEBA DE DORMIR EN MILISEGUNDOS Y HASTA UN TICK
+	if (crear_proceso("prueba_reloj")<0)
+		printf("Error creando prueba_reloj\n");
+*/
+
+/* PRUEBA DE LA PAGINA COMPARTIDA CON EL NUCLEO
+	if (crear_proceso("prueba_pagina")<0)
+		printf("Error creando prueba_pagina\n");
+*/
+
+/* PRUEBA DE LAS ESPERAS CON PLAZO EN MUTEX
+	if (crear_proceso("prueba_plazo_mutex")<0)
+		printf("Error creando prueba_plazo_mutex\n");
+*/
+
+/* PRUEBA DE LAS ALARMAS
+	if (crear_proceso("prueba_alarma")<0)
+		printf("Error creando prueba_alarma\n");
+*/
+
+/* PRUEBA DE LA EXPULSION AL DESPERTAR DE UN LOCK
+	if (crear_proceso("prueba_lock_urgente")<0)
+		printf("Error creando prueba_lock_urgente\n");
+*/
+
+/* PRUEBA DE LA PROMOCION EN MLFQ AL BLOQUEARSE EN UN LOCK
+	if (crear_proceso("prueba_promocion")<0)
+		printf("Error creando prueba_promocion\n");
+*/
+
+/* PRUEBA DEL PRESTAMO DE TICKETS AL PROPIETARIO DE UN MUTEX
+	if (crear_proceso("prueba_prestamo")<0)
+		printf("Error creando prueba_prestamo\n");
+*/
+
 /* PRUEBA DEL TERMINAL
 	if (crear_proceso("prueba_term")<0)
 		printf("Error creando prueba_term\n");
@@ -0,0 +1,30 @@
+/*
+ * usuario/interactivo.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que duerme varias veces y al terminar muestra cuanto
+ * ha esperado en la cola de listos. Con la expulsion al despertar la espera
+ * debe ser mucho menor que una rodaja por despertar.
+ */
+
+#include "servicios.h"
+
+#define VECES 3
+
+int main(){
+	int i, id;
+	info_cpu info;
+
+	id=obtener_id_pr();
+	for (i=0; i<VECES; i++)
+		dormir(1);
+
+	obtener_info_cpu(id, &info);
+	printf("interactivo (%d): %d ticks esperando tras %d despertares\n",
+		id, info.ticks_espera, VECES);
+	return 0;
+}
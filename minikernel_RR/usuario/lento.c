@@ -0,0 +1,32 @@
+/*
+ * usuario/lento.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario de prioridad minima que "gasta CPU" y al terminar
+ * muestra la mayor espera que ha sufrido en la cola de listos.
+ */
+
+#include "servicios.h"
+
+#define TOT_ITER 20000000	/* ponga las que considere oportuno */
+
+int main(){
+	int i, id, tot=0;
+	info_cpu info;
+
+	id=obtener_id_pr();
+	if (fijar_prioridad(id, PRIORIDAD_MINIMA)<0)
+		printf("lento (%d): error fijando prioridad. NO DEBE APARECER\n", id);
+
+	for (i=0; i<TOT_ITER; i++)
+		tot+=i&1;
+
+	obtener_info_cpu(id, &info);
+	printf("lento (%d): termina con %d, espera maxima %d ticks\n", id, tot,
+		info.espera_maxima);
+	return 0;
+}
@@ -26,6 +26,31 @@
 
 int llamsis(int llamada, int nargs, ... /* args */);
 
+/* Pagina compartida con el nucleo: se pide su direccion la primera vez y
+   despues se lee sin llamada al sistema */
+static const pagina_nucleo *pagina=0;
+
+static const pagina_nucleo *pagina_compartida(){
+   pagina_nucleo *dir;
+
+   if (pagina==0 && llamsis(OBTENER_PAGINA, 1, (long)&dir)==0)
+      pagina=dir;
+   return pagina;
+}
+
+/* Lee los ticks de la pagina; si el nucleo la ha cambiado mientras tanto
+   (la lectura se ha interrumpido) se repite */
+static unsigned long long leer_ticks(const pagina_nucleo *p){
+   unsigned int sec;
+   unsigned long long ticks;
+
+   do {
+      sec=p->secuencia;
+      ticks=p->ticks;
+   } while ((sec&1) || sec!=p->secuencia);
+   return ticks;
+}
+
 
 /*
  *
@@ -45,16 +70,58 @@ int escribir(char *texto, unsigned int longi){
 }
 /*I. Funcion que devuelve el identificador de un proceso */
 int obtener_id_pr(){
+   const pagina_nucleo *p=pagina_compartida();
+
+   if (p)
+      return p->id_actual;
    return llamsis(ID_PROCESO, 0);
 }
 /*I. Funcion que duerme el proceso */
 int dormir(unsigned int segundos){
    return llamsis(DORMIR, 1, (long)segundos);
 }
+/*I. Funcion que duerme el proceso unos milisegundos */
+int dormir_ms(unsigned int ms){
+   return llamsis(DORMIR_MS, 1, (long)ms);
+}
+/*I. Funcion que duerme el proceso hasta un tick absoluto */
+int dormir_hasta(unsigned int tick){
+   return llamsis(DORMIR_HASTA, 1, (long)tick);
+}
+/*I. Funcion que devuelve los ticks desde el arranque */
+unsigned int obtener_ticks(){
+   const pagina_nucleo *p=pagina_compartida();
+
+   if (p)
+      return (unsigned int)leer_ticks(p);
+   return (unsigned int)llamsis(OBTENER_TICKS, 0);
+}
+/*Funcion que devuelve la hora del reloj CMOS en ms (con resolucion de un
+  tick) */
+unsigned long long obtener_reloj_ms(){
+   const pagina_nucleo *p=pagina_compartida();
+
+   if (p==0)
+      return 0;
+   return p->reloj_base+leer_ticks(p)*(1000/TICKS_POR_SEGUNDO);
+}
+/*Funcion que arma la alarma del proceso (0 la desarma) */
+int alarma(unsigned int ms, int periodica){
+   return llamsis(ALARMA, 2, (long)ms, (long)periodica);
+}
+/*Funcion que espera a que venza la alarma del proceso */
+int esperar_alarma(){
+   return llamsis(ESPERAR_ALARMA, 0);
+}
 /*I. Funcion que crea un mutex pasandole el nombre y el tipo */
 int crear_mutex(char *nombre, int tipo){
    return llamsis(CREAR_MUTEX, 2, (long)nombre, (long)tipo);
 }
+/*I. Funcion que crea un mutex esperando como mucho ms milisegundos a que
+  haya uno libre */
+int crear_mutex_timeout(char *nombre, int tipo, unsigned int ms){
+   return llamsis(CREAR_MUTEX_TIMEOUT, 3, (long)nombre, (long)tipo, (long)ms);
+}
 /*I. Funcion que abre un mutex pasandole el nombre que lo identifica */
 int abrir_mutex(char *nombre){
    return llamsis(ABRIR_MUTEX, 1, (long)nombre);
@@ -63,6 +130,10 @@ int abrir_mutex(char *nombre){
 int lock(unsigned int mutexid){
    return llamsis(LOCK, 1, (long)mutexid);
 }
+/*I. Funcion que bloquea el mutex esperando como mucho ms milisegundos */
+int lock_timeout(unsigned int mutexid, unsigned int ms){
+   return llamsis(LOCK_TIMEOUT, 2, (long)mutexid, (long)ms);
+}
 /*I. Funcion que desbloquea el proceso pasandole el id del mutex */
 int unlock(unsigned int mutexid){
    return llamsis(UNLOCK, 1, (long)mutexid);
@@ -71,5 +142,84 @@ int unlock(unsigned int mutexid){
 int cerrar_mutex(unsigned int mutexid){
    return llamsis(CERRAR_MUTEX, 1, (long)mutexid);
 }
+/*P. Funcion que fija la prioridad de un proceso (0 la mas urgente) */
+int fijar_prioridad(unsigned int id, unsigned int prioridad){
+   return llamsis(FIJAR_PRIORIDAD, 2, (long)id, (long)prioridad);
+}
+/*CFS. Funcion que fija el nice de un proceso (-20 a 19) */
+int fijar_nice(unsigned int id, int nice){
+   return llamsis(FIJAR_NICE, 2, (long)id, (long)nice);
+}
+/*STRIDE. Funcion que fija los tickets de un proceso */
+int fijar_tickets(unsigned int id, unsigned int tickets){
+   return llamsis(FIJAR_TICKETS, 2, (long)id, (long)tickets);
+}
+/*STRIDE. Funcion que transfiere tickets del proceso actual a otro */
+int transferir_tickets(unsigned int id, unsigned int tickets){
+   return llamsis(TRANSFERIR_TICKETS, 2, (long)id, (long)tickets);
+}
+/*EDF. Funcion que declara los parametros de tiempo real del proceso */
+int fijar_plazo(unsigned int ejecucion, unsigned int periodo, unsigned int plazo){
+   return llamsis(FIJAR_PLAZO, 3, (long)ejecucion, (long)periodo, (long)plazo);
+}
+/*C. Funcion que obtiene la contabilidad de UCP de un proceso */
+int obtener_info_cpu(unsigned int id, info_cpu *info){
+   return llamsis(OBTENER_INFO_CPU, 2, (long)id, (long)info);
+}
+/*T. Funcion que vuelca por el terminal la traza del planificador */
+int volcar_traza(){
+   return llamsis(VOLCAR_TRAZA, 0);
+}
+/*CE. Funcion que cede la UCP pasando al final de la cola de listos */
+int ceder(){
+   return llamsis(CEDER, 0);
+}
+/*CE. Funcion que cede lo que queda de la rodaja a un proceso listo */
+int ceder_a(unsigned int id){
+   return llamsis(CEDER_A, 1, (long)id);
+}
+/*L. Funcion que obtiene las estadisticas de carga del sistema */
+int obtener_carga(info_carga *info){
+   return llamsis(OBTENER_CARGA, 1, (long)info);
+}
+/*Funcion que fija la clase de planificacion de un proceso */
+int fijar_politica(unsigned int id, unsigned int clase){
+   return llamsis(FIJAR_POLITICA, 2, (long)id, (long)clase);
+}
+/*Funcion que registra el aviso de no expulsion del proceso (NULL lo anula) */
+int fijar_aviso_expulsion(aviso_expulsion *aviso){
+   return llamsis(FIJAR_AVISO_EXPULSION, 1, (long)aviso);
+}
+/*Funcion que crea un grupo de procesos con el peso indicado */
+int crear_grupo(unsigned int peso){
+   return llamsis(CREAR_GRUPO, 1, (long)peso);
+}
+/*Funcion que pasa el proceso actual a un grupo */
+int unirse_grupo(unsigned int id){
+   return llamsis(UNIRSE_GRUPO, 1, (long)id);
+}
+/*Funcion que registra al proceso como agente de planificacion (NULL lo retira) */
+int registrar_agente(anillo_agente *anillo){
+   return llamsis(REGISTRAR_AGENTE, 1, (long)anillo);
+}
+/*Funcion que bloquea al agente hasta que haya eventos en su anillo */
+int esperar_eventos(){
+   return llamsis(ESPERAR_EVENTOS, 0);
+}
+/*Funcion que marca la entrada en una seccion critica corta. No hace ninguna
+  llamada al sistema */
+void entrar_seccion(aviso_expulsion *aviso){
+   aviso->en_seccion=1;
+}
+/*Funcion que marca la salida de la seccion critica y cede la UCP si el
+  nucleo ha prorrogado la rodaja mientras tanto. Devuelve 1 si ha cedido */
+int salir_seccion(aviso_expulsion *aviso){
+   aviso->en_seccion=0;
+   if (!aviso->ceder_pendiente)
+      return 0;
+   aviso->ceder_pendiente=0;
+   ceder();
+   return 1;
+}
 
 
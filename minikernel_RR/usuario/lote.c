@@ -0,0 +1,29 @@
+/*
+ * usuario/lote.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario de la clase LOTE que "gasta CPU" con rodajas
+ * largas por detras de los procesos normales.
+ */
+
+#include "servicios.h"
+
+#define TOT_ITER 20000000	/* ponga las que considere oportuno */
+
+int main(){
+	int i, id, tot;
+	int j=5;
+
+	id=obtener_id_pr();
+	if (fijar_politica(id, CLASE_LOTE)<0)
+		printf("lote (%d): error fijando la clase. NO DEBE APARECER\n", id);
+
+	for (i=0; i<TOT_ITER; i++)
+		tot=j*i;
+	printf("lote (%d): termina con %d\n", id, tot);
+	return 0;
+}
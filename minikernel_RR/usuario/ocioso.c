@@ -0,0 +1,29 @@
+/*
+ * usuario/ocioso.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario de la clase OCIOSA que "gasta CPU": solo debe
+ * ejecutar cuando no hay ningun otro proceso listo.
+ */
+
+#include "servicios.h"
+
+#define TOT_ITER 20000000	/* ponga las que considere oportuno */
+
+int main(){
+	int i, id, tot;
+	int j=5;
+
+	id=obtener_id_pr();
+	if (fijar_politica(id, CLASE_OCIOSA)<0)
+		printf("ocioso (%d): error fijando la clase. NO DEBE APARECER\n", id);
+
+	for (i=0; i<TOT_ITER; i++)
+		tot=j*i;
+	printf("ocioso (%d): termina con %d\n", id, tot);
+	return 0;
+}
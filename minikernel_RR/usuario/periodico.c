@@ -0,0 +1,34 @@
+/*
+ * usuario/periodico.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario de tiempo real que ejecuta un bucle de control
+ * periodico.
+ */
+
+#include "servicios.h"
+
+#define TOT_ITER 3	/* ponga las que considere oportuno */
+
+int main(){
+	int i, id;
+
+	id=obtener_id_pr();
+
+	/* 2 ticks de ejecucion cada 20 ticks: utilizacion 0.1 */
+	if (fijar_plazo(2, 20, 20)<0) {
+		printf("periodico (%d): rechazado por control de admision\n", id);
+		return 0;
+	}
+
+	for (i=0; i<TOT_ITER; i++) {
+		printf("periodico (%d): iteracion %d\n", id, i);
+		dormir(1);
+	}
+	printf("periodico (%d): termina\n", id);
+	return 0;
+}
@@ -0,0 +1,29 @@
+/*
+ * usuario/prestamista.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que espera por el mutex de prueba_prestamo. El
+ * primero que lo consigue debe tener tambien los tickets del otro.
+ */
+
+#include "servicios.h"
+
+int main(){
+	int des, id;
+	info_cpu info;
+
+	id=obtener_id_pr();
+	if ((des=abrir_mutex("presta"))<0)
+		printf("prestamista: error abriendo mutex. NO DEBE APARECER\n");
+
+	lock(des);
+	obtener_info_cpu(id, &info);
+	printf("prestamista (%d): %d tickets con el mutex\n", id, info.tickets);
+	unlock(des);
+	cerrar_mutex(des);
+	return 0;
+}
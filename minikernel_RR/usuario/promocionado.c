@@ -0,0 +1,38 @@
+/*
+ * usuario/promocionado.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que gasta CPU hasta bajar de nivel y despues se
+ * bloquea en un lock: al conseguirlo debe estar un nivel por encima.
+ */
+
+#include "servicios.h"
+
+#define ITER 100000000
+
+int main(){
+	int des, i, id, tot=0;
+	unsigned int antes;
+	info_cpu info;
+
+	id=obtener_id_pr();
+	if ((des=abrir_mutex("promo"))<0)
+		printf("promocionado: error abriendo mutex. NO DEBE APARECER\n");
+
+	for (i=0; i<ITER; i++)
+		tot+=i;
+
+	obtener_info_cpu(id, &info);
+	antes=info.nivel;
+	lock(des);
+	obtener_info_cpu(id, &info);
+	printf("promocionado: nivel %d antes del lock y %d despues (%s)\n",
+		antes, info.nivel, (info.nivel+1==antes)?"sube":"NO SUBE");
+	unlock(des);
+	cerrar_mutex(des);
+	return tot;
+}
@@ -0,0 +1,32 @@
+/*
+ * usuario/proporcional.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que "gasta CPU" con un numero de tickets que depende
+ * de su pid, informando de su avance.
+ */
+
+#include "servicios.h"
+
+#define TOT_TRAMOS 5		/* ponga los que considere oportuno */
+#define ITER_TRAMO 20000000	/* iteraciones de cada tramo */
+
+int main(){
+	int i, j, id, tot=0;
+
+	id=obtener_id_pr();
+	if (fijar_tickets(id, (id+1)*100)<0)
+		printf("proporcional (%d): error fijando tickets. NO DEBE APARECER\n", id);
+
+	for (i=1; i<=TOT_TRAMOS; i++) {
+		for (j=0; j<ITER_TRAMO; j++)
+			tot=i+j;
+		printf("proporcional (%d) con %d tickets: tramo %d\n", id, (id+1)*100, i);
+	}
+	printf("proporcional (%d): termina con %d\n", id, tot);
+	return 0;
+}
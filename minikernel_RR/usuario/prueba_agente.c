@@ -0,0 +1,38 @@
+/*
+ * usuario/prueba_agente.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que realiza una prueba del agente de planificacion:
+ * arranca el agente y despues tres mudo. El agente ejecuta siempre el de
+ * menor identificador, asi que los mudo deben terminar uno tras otro.
+ */
+
+#include "servicios.h"
+
+int main(){
+	int i;
+	anillo_agente otro;
+
+	printf("prueba_agente: comienza\n");
+
+	if (crear_proceso("agente")<0)
+		printf("Error creando agente\n");
+
+	/* deja que el agente se registre */
+	dormir(1);
+
+	/* solo puede haber un agente -> error */
+	if (registrar_agente(&otro)<0)
+		printf("error registrando un segundo agente. DEBE APARECER\n");
+
+	for (i=1; i<=3; i++)
+		if (crear_proceso("mudo")<0)
+			printf("Error creando mudo\n");
+
+	printf("prueba_agente: termina\n");
+	return 0; 
+}
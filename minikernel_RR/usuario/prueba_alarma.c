@@ -0,0 +1,46 @@
+/*
+ * usuario/prueba_alarma.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que prueba las alarmas: una periodica de 100 ms debe
+ * vencer cada 10 ticks exactos, acumular vencimientos mientras el proceso
+ * hace otra cosa (dormir) y una de una vez de 250 ms debe tardar 25 ticks.
+ */
+
+#include "servicios.h"
+
+int main(){
+	int i, n;
+	unsigned int t0;
+
+	printf("prueba_alarma: comienza\n");
+
+	alarma(100, 1);
+	for (i=0; i<4; i++) {
+		n=esperar_alarma();
+		printf("prueba_alarma: periodica vence %d vez en el tick %d\n",
+			n, obtener_ticks());
+	}
+
+	/* mientras duerme la alarma sigue venciendo */
+	dormir_ms(350);
+	n=esperar_alarma();
+	printf("prueba_alarma: tras dormir 350 ms recoge %d vencimientos\n", n);
+
+	alarma(0, 0);
+	if (esperar_alarma()<0)
+		printf("error esperando sin alarma. DEBE APARECER\n");
+
+	t0=obtener_ticks();
+	alarma(250, 0);
+	n=esperar_alarma();
+	printf("prueba_alarma: la de una vez vence %d vez tras %d ticks\n",
+		n, obtener_ticks()-t0);
+
+	printf("prueba_alarma: termina\n");
+	return 0; 
+}
@@ -0,0 +1,33 @@
+/*
+ * usuario/prueba_aviso.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que realiza una prueba del aviso de no expulsion:
+ * varios procesos compiten por un mutex que solo retienen durante una
+ * seccion critica corta.
+ */
+
+#include "servicios.h"
+
+int main(){
+	int i;
+
+	printf("prueba_aviso: comienza\n");
+
+	if (crear_mutex("seccion", NO_RECURSIVO)<0)
+		printf("error creando seccion. NO DEBE APARECER\n");
+
+	for (i=1; i<=3; i++)
+		if (crear_proceso("critico")<0)
+			printf("Error creando critico\n");
+
+	/* espera a que lo abran los critico antes de terminar y cerrarlo */
+	dormir(1);
+
+	printf("prueba_aviso: termina\n");
+	return 0; 
+}
@@ -0,0 +1,55 @@
+/*
+ * usuario/prueba_carga.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que realiza una prueba de las estadisticas de carga.
+ * Con tres mudo ejecutando la carga a 1s debe acercarse a 3 mientras que
+ * las de 10s y 60s crecen mas despacio.
+ */
+
+#include "servicios.h"
+
+#define SEGUNDOS 5
+
+/* Escribe una carga en coma fija con dos decimales */
+static void escribir_carga(unsigned int carga){
+	unsigned int centesimas=(carga%FIJO_CARGA)*100/FIJO_CARGA;
+
+	printf(" %d.%d%d", carga/FIJO_CARGA, centesimas/10, centesimas%10);
+}
+
+int main(){
+	int i, j;
+	info_carga info;
+
+	printf("prueba_carga: comienza\n");
+
+	if (obtener_carga(0)<0)
+		printf("error con destino nulo. DEBE APARECER\n");
+
+	for (i=1; i<=3; i++)
+		if (crear_proceso("mudo")<0)
+			printf("Error creando mudo\n");
+
+	for (i=0; i<SEGUNDOS; i++) {
+		dormir(1);
+		obtener_carga(&info);
+		printf("prueba_carga: carga");
+		for (j=0; j<3; j++)
+			escribir_carga(info.carga[j]);
+		printf(" listos %d dormidos %d mutex %d\n", info.listos,
+			info.dormidos, info.esperando_mutex);
+	}
+
+	printf("prueba_carga: ticks por longitud de la cola de listos\n");
+	for (i=0; i<TAM_HISTOGRAMA; i++)
+		if (info.histograma[i]>0)
+			printf("\t%d: %d\n", i, info.histograma[i]);
+
+	printf("prueba_carga: termina\n");
+	return 0; 
+}
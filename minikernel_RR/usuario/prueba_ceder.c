@@ -0,0 +1,40 @@
+/*
+ * usuario/prueba_ceder.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que realiza una prueba de la cesion de la UCP. Los
+ * cedentes deben alternarse iteracion a iteracion y este proceso cede lo
+ * que le queda de rodaja a cada uno de ellos.
+ */
+
+#include "servicios.h"
+
+#define NUM_PROCS 10	/* tamaño de la tabla de procesos del kernel */
+
+int main(){
+	int i, id;
+
+	id=obtener_id_pr();
+	printf("prueba_ceder: comienza\n");
+
+	if (ceder_a(id)<0)
+		printf("error cediendo a si mismo. DEBE APARECER\n");
+
+	if (ceder_a(NUM_PROCS)<0)
+		printf("error cediendo a proceso inexistente. DEBE APARECER\n");
+
+	for (i=1; i<=2; i++)
+		if (crear_proceso("cedente")<0)
+			printf("Error creando cedente\n");
+
+	for (i=0; i<NUM_PROCS; i++)
+		if (i!=id && ceder_a(i)==0)
+			printf("prueba_ceder: ha cedido la UCP a %d\n", i);
+
+	printf("prueba_ceder: termina\n");
+	return 0; 
+}
@@ -0,0 +1,34 @@
+/*
+ * usuario/prueba_clases.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que realiza una prueba de las clases de
+ * planificacion: un proceso de la clase OCIOSA, uno de la clase LOTE y uno
+ * normal "gastan CPU". Deben terminar en orden inverso al de creacion.
+ */
+
+#include "servicios.h"
+
+int main(){
+	printf("prueba_clases: comienza\n");
+
+	/* clase inexistente -> error */
+	if (fijar_politica(obtener_id_pr(), CLASE_OCIOSA+1)<0)
+		printf("error fijando una clase inexistente. DEBE APARECER\n");
+
+	if (crear_proceso("ocioso")<0)
+		printf("Error creando ocioso\n");
+
+	if (crear_proceso("lote")<0)
+		printf("Error creando lote\n");
+
+	if (crear_proceso("mudo")<0)
+		printf("Error creando mudo\n");
+
+	printf("prueba_clases: termina\n");
+	return 0; 
+}
@@ -0,0 +1,57 @@
+/*
+ * usuario/prueba_cpu.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que realiza una prueba de la contabilidad de UCP.
+ * Cada segundo muestra los contadores de todos los procesos existentes:
+ * los mudo deben acumular ticks de usuario y expulsiones, y el dormilon
+ * cambios voluntarios y rafagas cortas. Con POLITICA=rafaga el dormilon debe
+ * ejecutar por delante de los mudo al despertar.
+ */
+
+#include "servicios.h"
+
+#define NUM_PROCS 10	/* tamaño de la tabla de procesos del kernel */
+
+int main(){
+	int i, quedan;
+	info_cpu info;
+
+	printf("prueba_cpu: comienza\n");
+
+	if (obtener_info_cpu(obtener_id_pr(), 0)<0)
+		printf("error con destino nulo. DEBE APARECER\n");
+
+	if (obtener_info_cpu(NUM_PROCS, &info)<0)
+		printf("error con proceso inexistente. DEBE APARECER\n");
+
+	for (i=1; i<=2; i++)
+		if (crear_proceso("mudo")<0)
+			printf("Error creando mudo\n");
+
+	if (crear_proceso("dormilon")<0)
+		printf("Error creando dormilon\n");
+
+	do {
+		dormir(1);
+		quedan=0;
+		printf("pid\tusuario\tnucleo\tespera\tvolunt\tinvol\trafaga\tprevista\n");
+		for (i=0; i<NUM_PROCS; i++) {
+			if (obtener_info_cpu(i, &info)<0)
+				continue;
+			if (i!=obtener_id_pr())
+				quedan++;
+			printf("%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\n", i, info.ticks_usuario,
+				info.ticks_nucleo, info.ticks_espera,
+				info.cambios_voluntarios, info.cambios_involuntarios,
+				info.ultima_rafaga, info.rafaga_prevista/FIJO_RAFAGA);
+		}
+	} while (quedan>0);
+
+	printf("prueba_cpu: termina\n");
+	return 0; 
+}
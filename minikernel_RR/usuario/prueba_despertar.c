@@ -0,0 +1,31 @@
+/*
+ * usuario/prueba_despertar.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que realiza una prueba de la expulsion al despertar:
+ * un proceso interactivo compite con dos que gastan UCP. Con la politica rr
+ * el interactivo debe pasar a la cola de interactivos y los mudo a rodajas
+ * largas.
+ */
+
+#include "servicios.h"
+
+int main(){
+	int i;
+
+	printf("prueba_despertar: comienza\n");
+
+	for (i=1; i<=2; i++)
+		if (crear_proceso("mudo")<0)
+			printf("Error creando mudo\n");
+
+	if (crear_proceso("interactivo")<0)
+		printf("Error creando interactivo\n");
+
+	printf("prueba_despertar: termina\n");
+	return 0; 
+}
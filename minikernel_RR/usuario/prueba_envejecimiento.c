@@ -0,0 +1,30 @@
+/*
+ * usuario/prueba_envejecimiento.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que realiza una prueba del envejecimiento. Con
+ * POLITICA==POL_MLFQ el proceso lento, de prioridad minima, debe terminar
+ * antes que los mudo gracias a que sube de nivel mientras espera.
+ */
+
+#include "servicios.h"
+
+int main(){
+	int i;
+
+	printf("prueba_envejecimiento: comienza\n");
+
+	for (i=1; i<=2; i++)
+		if (crear_proceso("mudo")<0)
+			printf("Error creando mudo\n");
+
+	if (crear_proceso("lento")<0)
+		printf("Error creando lento\n");
+
+	printf("prueba_envejecimiento: termina\n");
+	return 0; 
+}
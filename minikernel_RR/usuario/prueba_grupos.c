@@ -0,0 +1,49 @@
+/*
+ * usuario/prueba_grupos.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que realiza una prueba del reparto justo entre
+ * grupos: un grupo con un solo mudo y otro del mismo peso con cuatro.
+ * Con POLITICA=grupos el mudo que esta solo debe terminar bastante antes
+ * que los otros cuatro. Antes, un hijo agota los grupos sin usarlos y
+ * termina: deben quedar libres otra vez.
+ */
+
+#include "servicios.h"
+
+int main(){
+	int i, g1, g2;
+
+	printf("prueba_grupos: comienza\n");
+
+	/* peso fuera de rango -> error */
+	if (crear_grupo(0)<0)
+		printf("error creando grupo de peso 0. DEBE APARECER\n");
+
+	/* los grupos vacios de un proceso que termina se liberan */
+	if (crear_proceso("acaparador")<0)
+		printf("Error creando acaparador\n");
+	dormir(1);
+
+	if ((g1=crear_grupo(100))<0)
+		printf("error creando grupo. NO DEBE APARECER\n");
+	if ((g2=crear_grupo(100))<0)
+		printf("error creando grupo. NO DEBE APARECER\n");
+
+	/* los hijos heredan el grupo del padre */
+	unirse_grupo(g1);
+	if (crear_proceso("mudo")<0)
+		printf("Error creando mudo\n");
+
+	unirse_grupo(g2);
+	for (i=1; i<=4; i++)
+		if (crear_proceso("mudo")<0)
+			printf("Error creando mudo\n");
+
+	printf("prueba_grupos: termina\n");
+	return 0; 
+}
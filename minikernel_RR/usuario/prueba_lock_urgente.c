@@ -0,0 +1,47 @@
+/*
+ * usuario/prueba_lock_urgente.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que prueba la expulsion al despertar de un lock: un
+ * proceso poco prioritario tiene un mutex por el que espera uno urgente.
+ * Al liberarlo el urgente debe ejecutar en ese mismo tick, antes de que el
+ * que lo libera siga, sin esperar a que venza su rodaja.
+ */
+
+#include "servicios.h"
+
+#define ITER 20000000
+
+int main(){
+	int des, i, tot=0;
+	unsigned int tick;
+
+	printf("prueba_lock_urgente: comienza\n");
+
+	fijar_prioridad(obtener_id_pr(), PRIORIDAD_MINIMA);
+	if ((des=crear_mutex("urgente", NO_RECURSIVO))<0)
+		printf("error creando mutex. NO DEBE APARECER\n");
+	if (lock(des)<0)
+		printf("error en lock. NO DEBE APARECER\n");
+
+	if (crear_proceso("bloqueado_urgente")<0)
+		printf("Error creando bloqueado_urgente\n");
+
+	/* deja que se bloquee en el mutex y gasta parte de la rodaja */
+	dormir_ms(100);
+	for (i=0; i<ITER/10; i++)
+		tot+=i;
+
+	tick=obtener_ticks();
+	unlock(des);
+	printf("prueba_lock_urgente: ha liberado el mutex en el tick %d\n", tick);
+
+	for (i=0; i<ITER; i++)
+		tot+=i;
+	printf("prueba_lock_urgente: termina (%d)\n", tot);
+	return 0; 
+}
@@ -0,0 +1,43 @@
+/*
+ * usuario/prueba_pagina.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que prueba la pagina compartida con el nucleo:
+ * obtener_id_pr, obtener_ticks y obtener_reloj_ms la leen sin llamada al
+ * sistema. Un millon de lecturas de los ticks deben tardar muy poco y
+ * medio segundo de sueño deben ser 50 ticks y unos 500 ms de reloj.
+ */
+
+#include "servicios.h"
+
+#define LECTURAS 1000000
+
+int main(){
+	unsigned int i, t0, t, anterior;
+	unsigned long long ms0;
+
+	printf("prueba_pagina: comienza con id %d\n", obtener_id_pr());
+
+	t0=anterior=obtener_ticks();
+	for (i=0; i<LECTURAS; i++) {
+		t=obtener_ticks();
+		if (t<anterior)
+			printf("prueba_pagina: los ticks retroceden. NO DEBE APARECER\n");
+		anterior=t;
+	}
+	printf("prueba_pagina: %d lecturas de los ticks en %d ticks\n",
+		LECTURAS, obtener_ticks()-t0);
+
+	t0=obtener_ticks();
+	ms0=obtener_reloj_ms();
+	dormir_ms(500);
+	printf("prueba_pagina: dormir_ms(500) son %d ticks y %d ms de reloj\n",
+		obtener_ticks()-t0, (int)(obtener_reloj_ms()-ms0));
+
+	printf("prueba_pagina: termina con id %d\n", obtener_id_pr());
+	return 0; 
+}
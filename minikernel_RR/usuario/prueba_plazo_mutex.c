@@ -0,0 +1,38 @@
+/*
+ * usuario/prueba_plazo_mutex.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que prueba las esperas con plazo en mutex: tiene
+ * bloqueado un mutex durante un segundo y medio mientras impaciente
+ * intenta conseguirlo con lock_timeout.
+ */
+
+#include "servicios.h"
+
+int main(){
+	int des;
+
+	printf("prueba_plazo_mutex: comienza\n");
+
+	if ((des=crear_mutex_timeout("plazo", NO_RECURSIVO, 100))<0)
+		printf("error creando mutex. NO DEBE APARECER\n");
+
+	if (lock(des)<0)
+		printf("error en lock. NO DEBE APARECER\n");
+
+	if (crear_proceso("impaciente")<0)
+		printf("Error creando impaciente\n");
+
+	dormir_ms(1500);
+	printf("prueba_plazo_mutex: libera el mutex en el tick %d\n", obtener_ticks());
+	if (unlock(des)<0)
+		printf("error en unlock. NO DEBE APARECER\n");
+
+	dormir(1);
+	printf("prueba_plazo_mutex: termina\n");
+	return 0; 
+}
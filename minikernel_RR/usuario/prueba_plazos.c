@@ -0,0 +1,43 @@
+/*
+ * usuario/prueba_plazos.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que realiza una prueba de la clase de tiempo real
+ * por plazos (EDF) y de su control de admision.
+ */
+
+#include "servicios.h"
+
+int main(){
+	int i;
+
+	printf("prueba_plazos: comienza\n");
+
+	/* ejecucion mayor que el plazo -> error */
+	if (fijar_plazo(11, 10, 10)<0)
+		printf("error fijando plazo no valido. DEBE APARECER\n");
+
+	/* utilizacion 0.8 */
+	if (fijar_plazo(8, 10, 10)<0)
+		printf("error fijando plazo. NO DEBE APARECER\n");
+
+	for (i=1; i<=2; i++)
+		if (crear_proceso("mudo")<0)
+			printf("Error creando mudo\n");
+
+	/* cada periodico pide 0.1: se deben admitir dos y rechazar el tercero */
+	for (i=1; i<=3; i++)
+		if (crear_proceso("periodico")<0)
+			printf("Error creando periodico\n");
+
+	printf("prueba_plazos duerme 1 seg.: ejecutaran los periodico antes que los mudo\n");
+	dormir(1);
+
+	fijar_plazo(0, 0, 0);
+	printf("prueba_plazos: termina\n");
+	return 0; 
+}
@@ -0,0 +1,52 @@
+/*
+ * usuario/prueba_prestamo.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que prueba que el prestamo de tickets sigue al
+ * propietario del mutex: dos prestamista esperan por un mutex de este
+ * proceso y le prestan sus tickets. Al soltarlo debe quedarse solo con
+ * los suyos y el nuevo propietario recibir los del que sigue esperando.
+ * Tiene sentido sobre todo con POLITICA=stride.
+ */
+
+#include "servicios.h"
+
+int main(){
+	int des, i, id, hijos[2];
+	unsigned int con_prestamo;
+	info_cpu info;
+
+	id=obtener_id_pr();
+	printf("prueba_prestamo: comienza\n");
+
+	if ((des=crear_mutex("presta", NO_RECURSIVO))<0)
+		printf("error creando mutex. NO DEBE APARECER\n");
+	lock(des);
+
+	for (i=0; i<2; i++)
+		if ((hijos[i]=crear_proceso("prestamista"))<0)
+			printf("Error creando prestamista\n");
+
+	/* espera a que los dos se bloqueen en el mutex */
+	for (i=0; i<2; i++)
+		do {
+			dormir_ms(10);
+			obtener_info_cpu(hijos[i], &info);
+		} while (info.cambios_voluntarios==0);
+
+	obtener_info_cpu(id, &info);
+	con_prestamo=info.tickets;
+	unlock(des);
+	obtener_info_cpu(id, &info);
+	printf("prueba_prestamo: %d tickets con el mutex y %d al soltarlo (%s)\n",
+		con_prestamo, info.tickets,
+		(con_prestamo==3*info.tickets)?"bien":"NO DEBE APARECER");
+
+	cerrar_mutex(des);
+	printf("prueba_prestamo: termina\n");
+	return 0; 
+}
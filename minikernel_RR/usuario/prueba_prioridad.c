@@ -0,0 +1,34 @@
+/*
+ * usuario/prueba_prioridad.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que realiza una prueba de la cola de listos
+ * multiprioridad: un proceso urgente debe ejecutar por delante de
+ * varios procesos que "gastan CPU".
+ */
+
+#include "servicios.h"
+
+int main(){
+	int i;
+
+	printf("prueba_prioridad: comienza\n");
+
+	/* prioridad fuera de rango -> error */
+	if (fijar_prioridad(obtener_id_pr(), PRIORIDAD_MINIMA+1)<0)
+		printf("error fijando prioridad fuera de rango. DEBE APARECER\n");
+
+	for (i=1; i<=3; i++)
+		if (crear_proceso("mudo")<0)
+			printf("Error creando mudo\n");
+
+	if (crear_proceso("urgente")<0)
+		printf("Error creando urgente\n");
+
+	printf("prueba_prioridad: termina\n");
+	return 0; 
+}
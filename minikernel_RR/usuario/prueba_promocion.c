@@ -0,0 +1,38 @@
+/*
+ * usuario/prueba_promocion.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que prueba que en MLFQ un proceso sube de nivel al
+ * bloquearse en un lock: promocionado gasta varias rodajas (baja de nivel)
+ * y despues espera por un mutex que tiene este proceso.
+ */
+
+#include "servicios.h"
+
+int main(){
+	int des, id;
+	info_cpu info;
+
+	printf("prueba_promocion: comienza\n");
+
+	if ((des=crear_mutex("promo", NO_RECURSIVO))<0)
+		printf("error creando mutex. NO DEBE APARECER\n");
+	lock(des);
+
+	if ((id=crear_proceso("promocionado"))<0)
+		printf("Error creando promocionado\n");
+
+	/* espera a que promocionado se bloquee en el mutex */
+	do {
+		dormir_ms(10);
+		obtener_info_cpu(id, &info);
+	} while (info.cambios_voluntarios==0);
+
+	unlock(des);
+	printf("prueba_promocion: termina\n");
+	return 0; 
+}
@@ -0,0 +1,46 @@
+/*
+ * usuario/prueba_reloj.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que prueba dormir_ms, dormir_hasta y obtener_ticks:
+ * los dormir_ms(20) deben durar 2 ticks y el bucle periodico con
+ * dormir_hasta debe despertar cada 10 ticks exactos aunque trabaje en
+ * cada vuelta.
+ */
+
+#include "servicios.h"
+
+int main(){
+	unsigned int i, j, antes, prox;
+	volatile unsigned int x=0;
+
+	printf("prueba_reloj: comienza en el tick %d\n", obtener_ticks());
+
+	for (i=0; i<3; i++) {
+		antes=obtener_ticks();
+		dormir_ms(20);
+		printf("prueba_reloj: dormir_ms(20) ha durado %d ticks\n",
+			obtener_ticks()-antes);
+	}
+
+	prox=obtener_ticks();
+	for (i=0; i<5; i++) {
+		for (j=0; j<5000000; j++)
+			x+=j;
+		prox+=10;
+		dormir_hasta(prox);
+		printf("prueba_reloj: periodico despierta en el tick %d (pedido %d)\n",
+			obtener_ticks(), prox);
+	}
+
+	/* tick pasado -> error */
+	if (dormir_hasta(obtener_ticks()-1)<0)
+		printf("error durmiendo hasta un tick pasado. DEBE APARECER\n");
+
+	printf("prueba_reloj: termina\n");
+	return 0; 
+}
@@ -0,0 +1,40 @@
+/*
+ * usuario/prueba_tickets.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que realiza una prueba del reparto proporcional
+ * por tickets. Con POLITICA==POL_STRIDE los procesos proporcional deben
+ * avanzar en proporcion a sus tickets.
+ */
+
+#include "servicios.h"
+
+int main(){
+	int i, id;
+
+	id=obtener_id_pr();
+	printf("prueba_tickets: comienza\n");
+
+	if (fijar_tickets(id, 0)<0)
+		printf("error fijando 0 tickets. DEBE APARECER\n");
+
+	if (fijar_tickets(id, 50)<0)
+		printf("error fijando tickets. NO DEBE APARECER\n");
+
+	if (transferir_tickets(id, 10)<0)
+		printf("error transfiriendo tickets a si mismo. DEBE APARECER\n");
+
+	if (transferir_tickets(id, 50)<0)
+		printf("error transfiriendo todos sus tickets. DEBE APARECER\n");
+
+	for (i=1; i<=3; i++)
+		if (crear_proceso("proporcional")<0)
+			printf("Error creando proporcional\n");
+
+	printf("prueba_tickets: termina\n");
+	return 0; 
+}
@@ -0,0 +1,42 @@
+/*
+ * usuario/prueba_traza.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que realiza una prueba de la traza del planificador.
+ * Vuelca la traza tras un segundo de actividad; el resto se vuelca al
+ * terminar el ultimo proceso. Durante ese segundo bloqueado_urgente espera
+ * por un mutex que tiene este proceso, de modo que en la traza debe
+ * aparecer su bloqueo en el lock y su despertar antes de volver a ejecutar. La salida se convierte con
+ * herramientas/traza_json.
+ */
+
+#include "servicios.h"
+
+int main(){
+	int des;
+
+	printf("prueba_traza: comienza\n");
+
+	if ((des=crear_mutex("urgente", NO_RECURSIVO))<0)
+		printf("error creando mutex. NO DEBE APARECER\n");
+	lock(des);
+	if (crear_proceso("bloqueado_urgente")<0)
+		printf("Error creando bloqueado_urgente\n");
+
+	if (crear_proceso("mudo")<0)
+		printf("Error creando mudo\n");
+
+	if (crear_proceso("dormilon")<0)
+		printf("Error creando dormilon\n");
+
+	dormir(1);
+	unlock(des);
+	volcar_traza();
+
+	printf("prueba_traza: termina\n");
+	return 0; 
+}
@@ -0,0 +1,31 @@
+/*
+ * usuario/urgente.c
+ *
+ *  Minikernel. Versión 1.0
+ *
+ */
+
+/*
+ * Programa de usuario que se pone la maxima prioridad y duerme varias
+ * veces: cada vez que despierta debe ejecutar antes que los procesos
+ * de menor prioridad que estan listos.
+ */
+
+#include "servicios.h"
+
+#define TOT_ITER 3	/* ponga las que considere oportuno */
+
+int main(){
+	int i, id;
+
+	id=obtener_id_pr();
+	if (fijar_prioridad(id, PRIORIDAD_MAXIMA)<0)
+		printf("urgente (%d): error fijando prioridad. NO DEBE APARECER\n", id);
+
+	for (i=0; i<TOT_ITER; i++) {
+		printf("urgente (%d): duerme 1 segundo\n", id);
+		dormir(1);
+	}
+	printf("urgente (%d): termina\n", id);
+	return 0;
+}